@@ -32,6 +32,7 @@ public class ConceptSkillSystem : ModuleRules
 				"GameplayAbilities",
 				"GameplayTags",
 				"GameplayTasks",
+				"NetCore",
 				"Niagara"
 				// ... add other public dependencies that you statically link with here ...
 			}
@@ -41,6 +42,7 @@ public class ConceptSkillSystem : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"AssetRegistry"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
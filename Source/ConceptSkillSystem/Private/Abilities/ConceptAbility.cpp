@@ -42,20 +42,7 @@ float UConceptAbility::CalculateAbilityPower(const AActor* SourceActor) const
 		if (Concept && ConceptComp->HasAcquiredConcept(Concept))
 		{
 			// Find the highest mastery level for this concept across all body parts
-			int32 HighestMastery = 0;
-
-			for (const auto& Pair : ConceptComp->BodyPartSlots)
-			{
-				const TArray<FConceptSlot>& Slots = Pair.Value;
-
-				for (const FConceptSlot& Slot : Slots)
-				{
-					if (!Slot.IsEmpty() && Slot.HeldConcept.Get() == Concept)
-					{
-						HighestMastery = FMath::Max(HighestMastery, Slot.MasteryLevel);
-					}
-				}
-			}
+			int32 HighestMastery = ConceptComp->GetHighestMasteryLevel(Concept);
 
 			TotalMastery += HighestMastery;
 			ConceptsFound++;
@@ -86,6 +73,9 @@ TArray<TSubclassOf<UGameplayEffect>> UConceptAbility::GetAbilityEffects() const
 
 void UConceptAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	// Snapshot concept state before anything predicted can change it
+	BeginConceptPrediction(ActorInfo, ActivationInfo);
+
 	// Call the parent implementation
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
@@ -148,6 +138,35 @@ void UConceptAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
+void UConceptAbility::BeginConceptPrediction(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo& ActivationInfo)
+{
+	// Only predicting clients can be wrong
+	FPredictionKey PredictionKey = ActivationInfo.GetActivationPredictionKey();
+	if (!ActorInfo || ActorInfo->IsNetAuthority() || !PredictionKey.IsValidKey())
+	{
+		return;
+	}
+
+	UConceptComponent* ConceptComp = UConceptSkillFunctionLibrary::GetConceptComponent(ActorInfo->AvatarActor.Get());
+	if (!ConceptComp)
+	{
+		return;
+	}
+
+	const int32 Key = PredictionKey.Current;
+	ConceptComp->BeginPredictionSnapshot(Key);
+
+	// Undo on rejection, keep on confirmation
+	PredictionKey.NewRejectedDelegate().BindWeakLambda(ConceptComp, [ConceptComp, Key]()
+	{
+		ConceptComp->RestoreSnapshot(Key);
+	});
+	PredictionKey.NewCaughtUpDelegate().BindWeakLambda(ConceptComp, [ConceptComp, Key]()
+	{
+		ConceptComp->CommitSnapshot(Key);
+	});
+}
+
 bool UConceptAbility::CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, OUT FGameplayTagContainer* OptionalRelevantTags) const
 {
 	// Call parent implementation first
@@ -165,6 +184,13 @@ bool UConceptAbility::CanActivateAbility(const FGameplayAbilitySpecHandle Handle
 			return false;
 		}
 
+		// Skills carry a compiled requirement program; the same one their unlock was checked with
+		if (UConceptSkill* Skill = SourceSkill.Get())
+		{
+			const FGameplayTagContainer& OwnerTags = ActorInfo->AbilitySystemComponent.IsValid() ? ActorInfo->AbilitySystemComponent->GetOwnedGameplayTags() : FGameplayTagContainer::EmptyContainer;
+			return Skill->GetRequirementProgram().Evaluate(ConceptComp, OwnerTags);
+		}
+
 		// Check each required concept
 		for (const auto& RequiredConcept : RequiredConcepts)
 		{
@@ -175,29 +201,7 @@ bool UConceptAbility::CanActivateAbility(const FGameplayAbilitySpecHandle Handle
 			}
 
 			// Check mastery level
-			bool HasSufficientMastery = false;
-
-			// Check each body part for the concept with sufficient mastery
-			for (const auto& Pair : ConceptComp->BodyPartSlots)
-			{
-				const TArray<FConceptSlot>& Slots = Pair.Value;
-
-				for (const FConceptSlot& Slot : Slots)
-				{
-					if (!Slot.IsEmpty() && Slot.HeldConcept.Get() == Concept && Slot.MasteryLevel >= RequiredMasteryLevel)
-					{
-						HasSufficientMastery = true;
-						break;
-					}
-				}
-
-				if (HasSufficientMastery)
-				{
-					break;
-				}
-			}
-
-			if (!HasSufficientMastery)
+			if (ConceptComp->GetHighestMasteryLevel(Concept) < RequiredMasteryLevel)
 			{
 				return false; // Insufficient mastery for a required concept
 			}
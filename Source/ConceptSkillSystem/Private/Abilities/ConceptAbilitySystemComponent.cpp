@@ -18,7 +18,7 @@ void UConceptAbilitySystemComponent::BeginPlay()
 
 FGameplayAbilitySpecHandle UConceptAbilitySystemComponent::GrantAbilityFromConceptSkill(UConceptSkill* Skill, int32 Level)
 {
-	if (!Skill || !Skill->GrantedAbility)
+	if (!Skill || !Skill->HasGrantedAbility())
 	{
 		return FGameplayAbilitySpecHandle();
 	}
@@ -37,8 +37,15 @@ FGameplayAbilitySpecHandle UConceptAbilitySystemComponent::GrantAbilityFromConce
 		return Handle;
 	}
 
+	// The class is normally prefetched before unlock; see UConceptSkillManager::PrefetchRequirementDistance
+	TSubclassOf<UGameplayAbility> AbilityClass = Skill->ResolveGrantedAbility();
+	if (!AbilityClass)
+	{
+		return FGameplayAbilitySpecHandle();
+	}
+
 	// Create the ability spec
-	FGameplayAbilitySpec AbilitySpec(Skill->GrantedAbility, Level, INDEX_NONE);
+	FGameplayAbilitySpec AbilitySpec(AbilityClass, Level, Skill->InputID);
 
 	// Set the source object to the skill
 	AbilitySpec.SourceObject = Skill;
@@ -103,7 +110,7 @@ void UConceptAbilitySystemComponent::UpdateAbilityLevelsFromConceptMastery()
 	for (const auto& SkillPtr : SkillManager->UnlockedSkills)
 	{
 		UConceptSkill* Skill = SkillPtr.Get();
-		if (Skill && Skill->GrantedAbility)
+		if (Skill && Skill->HasGrantedAbility())
 		{
 			// Calculate the effective power based on concept mastery
 			int32 EffectivePower = SkillManager->CalculateSkillEffectivePower(Skill);
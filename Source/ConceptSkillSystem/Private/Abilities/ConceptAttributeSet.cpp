@@ -4,6 +4,166 @@
 #include "Net/UnrealNetwork.h"
 #include "GameplayEffectExtension.h"
 #include "GameplayEffect.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Serialization/BitWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+// Models the replication compare step for attribute sets at a given player count, with every attribute polled for every
+// connection (the old setup) against push-model dirty tracking with the owner-only conditions. No net driver is involved;
+// the numbers are the property compares each model costs per connection per frame, and the bytes its sends serialize to
+// (each attribute's replicated fields through NetSerializeItem, before property handles and packet headers).
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ConceptAttributeRepBenchmarkCommand(
+	TEXT("ConceptSkill.AttributeRepBenchmark"),
+	TEXT("Compare polled and push-model attribute replication cost: ConceptSkill.AttributeRepBenchmark [Players=100] [Frames=300] [ChangeChance=0.05]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 NumPlayers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+		const int32 NumFrames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 300;
+		const float ChangeChance = Args.Num() > 2 ? FMath::Clamp(FCString::Atof(*Args[2]), 0.0f, 1.0f) : 0.05f;
+
+		// Every attribute, and whether every connection receives it or only the owner's
+		TArray<TPair<FStructProperty*, bool>> Attributes;
+		for (TFieldIterator<FStructProperty> It(UConceptAttributeSet::StaticClass()); It; ++It)
+		{
+			if (It->Struct == FGameplayAttributeData::StaticStruct())
+			{
+				const FName Name = It->GetFName();
+				Attributes.Emplace(*It, Name == GET_MEMBER_NAME_CHECKED(UConceptAttributeSet, ConceptPower) || Name == GET_MEMBER_NAME_CHECKED(UConceptAttributeSet, SkillPotency));
+			}
+		}
+		const int32 NumAttributes = Attributes.Num();
+
+		TArray<TStrongObjectPtr<UConceptAttributeSet>> Sets;
+		for (int32 Player = 0; Player < NumPlayers; ++Player)
+		{
+			Sets.Emplace(NewObject<UConceptAttributeSet>(GetTransientPackage()));
+		}
+
+		auto GetValue = [&Attributes, &Sets](int32 Player, int32 Attribute) -> FGameplayAttributeData&
+		{
+			return *Attributes[Attribute].Key->ContainerPtrToValuePtr<FGameplayAttributeData>(Sets[Player].Get());
+		};
+
+		// What each connection last received of each player's attributes
+		TArray<float> PolledShadow;
+		TArray<float> PushShadow;
+		PolledShadow.Init(0.0f, NumPlayers * NumPlayers * NumAttributes);
+		PushShadow.Init(0.0f, NumPlayers * NumPlayers * NumAttributes);
+
+		TBitArray<> Dirty(false, NumPlayers * NumAttributes);
+		TBitArray<> PlayerDirty(false, NumPlayers);
+
+		FRandomStream Random(NumPlayers);
+		double PolledSeconds = 0.0;
+		double PushSeconds = 0.0;
+		int64 PolledCompares = 0;
+		int64 PushCompares = 0;
+
+		// Sends per attribute, turned into bytes once the timed loops are done
+		TArray<int64> PolledSends;
+		TArray<int64> PushSends;
+		PolledSends.SetNumZeroed(NumAttributes);
+		PushSends.SetNumZeroed(NumAttributes);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 Player = 0; Player < NumPlayers; ++Player)
+			{
+				for (int32 Attribute = 0; Attribute < NumAttributes; ++Attribute)
+				{
+					if (Random.FRand() < ChangeChance)
+					{
+						FGameplayAttributeData& Value = GetValue(Player, Attribute);
+						Value.SetCurrentValue(Value.GetCurrentValue() + 1.0f);
+						Dirty[Player * NumAttributes + Attribute] = true;
+						PlayerDirty[Player] = true;
+					}
+				}
+			}
+
+			// Polled: every connection compares every attribute of every player
+			double Start = FPlatformTime::Seconds();
+			for (int32 Connection = 0; Connection < NumPlayers; ++Connection)
+			{
+				for (int32 Player = 0; Player < NumPlayers; ++Player)
+				{
+					float* Shadow = &PolledShadow[(Connection * NumPlayers + Player) * NumAttributes];
+					for (int32 Attribute = 0; Attribute < NumAttributes; ++Attribute)
+					{
+						const float Current = GetValue(Player, Attribute).GetCurrentValue();
+						if (Shadow[Attribute] != Current)
+						{
+							Shadow[Attribute] = Current;
+							++PolledSends[Attribute];
+						}
+						++PolledCompares;
+					}
+				}
+			}
+			PolledSeconds += FPlatformTime::Seconds() - Start;
+
+			// Push: only dirty attributes, and owner-only ones only for the owner's connection
+			Start = FPlatformTime::Seconds();
+			for (int32 Connection = 0; Connection < NumPlayers; ++Connection)
+			{
+				for (int32 Player = 0; Player < NumPlayers; ++Player)
+				{
+					if (!PlayerDirty[Player])
+					{
+						continue;
+					}
+
+					float* Shadow = &PushShadow[(Connection * NumPlayers + Player) * NumAttributes];
+					for (int32 Attribute = 0; Attribute < NumAttributes; ++Attribute)
+					{
+						if (!Dirty[Player * NumAttributes + Attribute] || (!Attributes[Attribute].Value && Connection != Player))
+						{
+							continue;
+						}
+
+						const float Current = GetValue(Player, Attribute).GetCurrentValue();
+						if (Shadow[Attribute] != Current)
+						{
+							Shadow[Attribute] = Current;
+							++PushSends[Attribute];
+						}
+						++PushCompares;
+					}
+				}
+			}
+			PushSeconds += FPlatformTime::Seconds() - Start;
+
+			Dirty.SetRange(0, Dirty.Num(), false);
+			PlayerDirty.SetRange(0, PlayerDirty.Num(), false);
+		}
+
+		// Serialized size of each attribute as it goes out, from the first player's (quantized, if enabled) values
+		int64 PolledBits = 0;
+		int64 PushBits = 0;
+		for (int32 Attribute = 0; Attribute < NumAttributes; ++Attribute)
+		{
+			FBitWriter Writer(0, true);
+			FGameplayAttributeData& Value = GetValue(0, Attribute);
+			for (TFieldIterator<FProperty> It(FGameplayAttributeData::StaticStruct()); It; ++It)
+			{
+				if (!It->HasAnyPropertyFlags(CPF_RepSkip))
+				{
+					It->NetSerializeItem(Writer, nullptr, It->ContainerPtrToValuePtr<void>(&Value));
+				}
+			}
+			PolledBits += PolledSends[Attribute] * Writer.GetNumBits();
+			PushBits += PushSends[Attribute] * Writer.GetNumBits();
+		}
+
+		const double ConnectionFrames = double(NumPlayers) * NumFrames;
+		const double PerConnectionFrame = 1000000.0 / ConnectionFrames;
+		Ar.Logf(TEXT("%d players, %d attributes, %d frames, %.1f%% change chance"), NumPlayers, NumAttributes, NumFrames, ChangeChance * 100.0f);
+		Ar.Logf(TEXT("Polled: %.3f us, %.1f compares and %.1f bytes per connection per frame"),
+			PolledSeconds * PerConnectionFrame, double(PolledCompares) / ConnectionFrames, double(PolledBits) / 8.0 / ConnectionFrames);
+		Ar.Logf(TEXT("Push:   %.3f us, %.1f compares and %.1f bytes per connection per frame"),
+			PushSeconds * PerConnectionFrame, double(PushCompares) / ConnectionFrames, double(PushBits) / 8.0 / ConnectionFrames);
+	}));
 
 UConceptAttributeSet::UConceptAttributeSet()
 {
@@ -28,26 +188,45 @@ UConceptAttributeSet::UConceptAttributeSet()
 
 	CraftingProficiency.SetBaseValue(1.0f);
 	CraftingProficiency.SetCurrentValue(1.0f);
+
+	// Quantization is opt-in
+	bQuantizeLowPrecisionAttributes = false;
+	RangeQuantizationStep = 10.0f;
+	MultiplierQuantizationStep = 0.01f;
 }
 
 void UConceptAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	// Register attributes for replication
-	DOREPLIFETIME_CONDITION_NOTIFY(UConceptAttributeSet, ConceptPower, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UConceptAttributeSet, ConceptCapacity, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UConceptAttributeSet, ConceptMastery, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UConceptAttributeSet, ObservationRange, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UConceptAttributeSet, ObservationSpeed, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UConceptAttributeSet, SkillPotency, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UConceptAttributeSet, CraftingProficiency, COND_None, REPNOTIFY_Always);
+	// Attributes are push-based: they are only compared when marked dirty
+	FDoRepLifetimeParams PublicParams;
+	PublicParams.bIsPushBased = true;
+	PublicParams.Condition = COND_None;
+	PublicParams.RepNotifyCondition = REPNOTIFY_Always;
+
+	FDoRepLifetimeParams OwnerParams = PublicParams;
+	OwnerParams.Condition = COND_OwnerOnly;
+
+	// Visible to everyone
+	DOREPLIFETIME_WITH_PARAMS_FAST(UConceptAttributeSet, ConceptPower, PublicParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UConceptAttributeSet, SkillPotency, PublicParams);
+
+	// Progression, observation and crafting stats only matter to the owning client
+	DOREPLIFETIME_WITH_PARAMS_FAST(UConceptAttributeSet, ConceptCapacity, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UConceptAttributeSet, ConceptMastery, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UConceptAttributeSet, ObservationRange, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UConceptAttributeSet, ObservationSpeed, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UConceptAttributeSet, CraftingProficiency, OwnerParams);
 }
 
 void UConceptAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
 {
 	Super::PreAttributeChange(Attribute, NewValue);
 
+	// Quantize first, so a step that doesn't divide a minimum can't snap the value below it
+	QuantizeAttributeValue(Attribute, NewValue);
+
 	// Clamp attributes to ensure they stay within valid ranges
 	if (Attribute == GetConceptPowerAttribute())
 	{
@@ -79,6 +258,68 @@ void UConceptAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribut
 	}
 }
 
+void UConceptAttributeSet::PreAttributeBaseChange(const FGameplayAttribute& Attribute, float& NewValue) const
+{
+	Super::PreAttributeBaseChange(Attribute, NewValue);
+
+	QuantizeAttributeValue(Attribute, NewValue);
+}
+
+void UConceptAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	if (OldValue != NewValue)
+	{
+		MarkAttributeDirty(Attribute);
+	}
+}
+
+void UConceptAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	if (OldValue != NewValue)
+	{
+		MarkAttributeDirty(Attribute);
+	}
+}
+
+void UConceptAttributeSet::QuantizeAttributeValue(const FGameplayAttribute& Attribute, float& NewValue) const
+{
+	if (!bQuantizeLowPrecisionAttributes)
+	{
+		return;
+	}
+
+	// ConceptPower and ConceptCapacity keep full precision
+	if (Attribute == GetObservationRangeAttribute())
+	{
+		if (RangeQuantizationStep > 0.0f)
+		{
+			NewValue = FMath::GridSnap(NewValue, RangeQuantizationStep);
+		}
+	}
+	else if (Attribute == GetObservationSpeedAttribute()
+		|| Attribute == GetCraftingProficiencyAttribute()
+		|| Attribute == GetConceptMasteryAttribute()
+		|| Attribute == GetSkillPotencyAttribute())
+	{
+		if (MultiplierQuantizationStep > 0.0f)
+		{
+			NewValue = FMath::GridSnap(NewValue, MultiplierQuantizationStep);
+		}
+	}
+}
+
+void UConceptAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attribute) const
+{
+	if (FProperty* Property = Attribute.GetUProperty())
+	{
+		MARK_PROPERTY_DIRTY(const_cast<UConceptAttributeSet*>(this), Property);
+	}
+}
+
 void UConceptAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
 	Super::PostGameplayEffectExecute(Data);
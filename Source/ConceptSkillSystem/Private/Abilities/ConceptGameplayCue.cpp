@@ -3,6 +3,7 @@
 #include "Abilities/ConceptGameplayCue.h"
 #include "Concept.h"
 #include "ConceptSkillTags.h"
+#include "ConceptSkillManager.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -12,6 +13,13 @@ UConceptGameplayCue::UConceptGameplayCue()
 	// Initialize default values
 }
 
+bool UConceptGameplayCue::NeedsLoadForServer() const
+{
+	// Dedicated servers never play cues; excluding the cue also keeps its particle, niagara and sound maps
+	// (and everything they reference) out of server packages
+	return false;
+}
+
 bool UConceptGameplayCue::OnExecute_Implementation(AActor* MyTarget, const FGameplayCueParameters& Parameters)
 {
 	// Call parent implementation
@@ -39,7 +47,7 @@ bool UConceptGameplayCue::OnExecute_Implementation(AActor* MyTarget, const FGame
 	if (TierNiagaraEffects.Contains(ConceptTier))
 	{
 		UNiagaraSystem* NiagaraSystem = TierNiagaraEffects[ConceptTier];
-		SpawnNiagaraEffect(MyTarget, NiagaraSystem, Color);
+		SpawnNiagaraEffect(MyTarget, NiagaraSystem, Color, GetExecutionCount());
 	}
 
 	return true;
@@ -131,6 +139,12 @@ FName UConceptGameplayCue::GetConceptElementFromParameters(const FGameplayCuePar
 	return ConceptElement;
 }
 
+int32 UConceptGameplayCue::GetExecutionCount() const
+{
+	// Set while the skill manager dispatches a merged batch entry; cues executed any other way count once
+	return UConceptSkillManager::GetDispatchedCueCount();
+}
+
 void UConceptGameplayCue::SpawnParticleEffect(AActor* Target, UParticleSystem* ParticleSystem, FLinearColor Color)
 {
 	if (!Target || !ParticleSystem)
@@ -152,7 +166,7 @@ void UConceptGameplayCue::SpawnParticleEffect(AActor* Target, UParticleSystem* P
 	}
 }
 
-void UConceptGameplayCue::SpawnNiagaraEffect(AActor* Target, UNiagaraSystem* NiagaraSystem, FLinearColor Color)
+void UConceptGameplayCue::SpawnNiagaraEffect(AActor* Target, UNiagaraSystem* NiagaraSystem, FLinearColor Color, int32 ExecutionCount)
 {
 	if (!Target || !NiagaraSystem)
 	{
@@ -170,6 +184,9 @@ void UConceptGameplayCue::SpawnNiagaraEffect(AActor* Target, UNiagaraSystem* Nia
 	if (NiagaraComponent)
 	{
 		NiagaraComponent->SetVariableLinearColor(TEXT("Color"), Color);
+
+		// Merged executions spawn one system, which can scale itself by how many hits it stands for
+		NiagaraComponent->SetVariableInt(TEXT("ExecutionCount"), ExecutionCount);
 	}
 }
 
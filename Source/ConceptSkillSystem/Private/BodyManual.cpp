@@ -5,7 +5,7 @@
 
 ABodyManual::ABodyManual()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	TargetBodyPart = EBodyPartType::Body;
 	MaxUnlockableTier = EConceptTier::Intermediate;
@@ -18,11 +18,6 @@ void ABodyManual::BeginPlay()
 	Super::BeginPlay();
 }
 
-void ABodyManual::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
 bool ABodyManual::UseManual(AActor* TargetCharacter)
 {
 	if (!TargetCharacter)
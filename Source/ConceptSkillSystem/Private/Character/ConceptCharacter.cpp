@@ -7,6 +7,7 @@
 #include "Abilities/ConceptAttributeSet.h"
 #include "ConceptObservable.h"
 #include "ConceptSkillFunctionLibrary.h"
+#include "ConceptObservationSubsystem.h"
 
 AConceptCharacter::AConceptCharacter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -78,6 +79,13 @@ bool AConceptCharacter::ObserveConcept(AActor* ObservableObject)
 		return false;
 	}
 
+	// Check this character's own cooldown on the object
+	const UConceptObservationSubsystem* Observation = UConceptObservationSubsystem::Get(this);
+	if (Observation && Observation->IsObservationOnCooldown(this, ObservableObject))
+	{
+		return false;
+	}
+
 	// Trigger the observation
 	IConceptObservable::Execute_OnObserved(ObservableObject, this);
 
@@ -141,11 +149,10 @@ void AConceptCharacter::InitializeAbilitySystem()
 			AttributeSet->SetConceptCapacity(static_cast<float>(ConceptComponent->GetTotalSlots()));
 		}
 
-		// Grant abilities for all unlocked skills
+		// Grant abilities and passives for unlocked skills not granted yet, time-sliced by the concept system
 		if (ConceptSkillManager)
 		{
-			ConceptSkillManager->GrantAbilitiesForUnlockedSkills();
-			ConceptSkillManager->ApplyPassiveEffects();
+			ConceptSkillManager->QueueAbilityGrants();
 		}
 	}
 }
@@ -1,6 +1,37 @@
 // Copyright Koorogi Games, Inc. All Rights Reserved.
 
 #include "Concept.h"
+#include "Engine/Texture2D.h"
+#include "Misc/ScopeExit.h"
+#if WITH_EDITOR
+#include "Interfaces/ITargetPlatform.h"
+#endif
+
+const FName ConceptAssetBundles::UI(TEXT("UI"));
+const FName ConceptAssetBundles::Gameplay(TEXT("Gameplay"));
+
+bool ConceptServerData::IsCookingForServer(const FArchive& Ar)
+{
+#if WITH_EDITOR
+	return Ar.IsSaving() && Ar.IsCooking() && Ar.CookingTarget() && Ar.CookingTarget()->IsServerOnly();
+#else
+	return false;
+#endif
+}
+
+SIZE_T ConceptServerData::GetDisplayDataSize(const FText& DisplayName, const FText& Description, const TSoftObjectPtr<UTexture2D>& Icon)
+{
+	SIZE_T Size = DisplayName.ToString().GetAllocatedSize() + Description.ToString().GetAllocatedSize();
+	Size += Icon.ToSoftObjectPath().ToString().GetAllocatedSize();
+
+	// A loaded icon is resident too, whether or not this asset is what keeps it loaded
+	if (UTexture2D* LoadedIcon = Icon.Get())
+	{
+		Size += LoadedIcon->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+	}
+
+	return Size;
+}
 
 UConcept::UConcept()
 {
@@ -14,3 +45,35 @@ FPrimaryAssetId UConcept::GetPrimaryAssetId() const
 {
 	return FPrimaryAssetId(TEXT("Concept"), GetFName());
 }
+
+void UConcept::Serialize(FArchive& Ar)
+{
+	if (!ConceptServerData::IsCookingForServer(Ar))
+	{
+		Super::Serialize(Ar);
+		return;
+	}
+
+	// Servers never show names, descriptions or icons: save them empty so the text and the icon reference
+	// never reach the server package, then restore them for the client cook
+	FText SavedDisplayName = MoveTemp(DisplayName);
+	FText SavedDescription = MoveTemp(Description);
+	TSoftObjectPtr<UTexture2D> SavedIcon = MoveTemp(Icon);
+	DisplayName = FText::GetEmpty();
+	Description = FText::GetEmpty();
+	Icon.Reset();
+
+	ON_SCOPE_EXIT
+	{
+		DisplayName = MoveTemp(SavedDisplayName);
+		Description = MoveTemp(SavedDescription);
+		Icon = MoveTemp(SavedIcon);
+	};
+
+	Super::Serialize(Ar);
+}
+
+SIZE_T UConcept::GetDisplayDataSize() const
+{
+	return ConceptServerData::GetDisplayDataSize(DisplayName, Description, Icon);
+}
@@ -0,0 +1,641 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptAcquisitionPlanner.h"
+#include "ConceptCatalog.h"
+#include "ConceptComponent.h"
+#include "ConceptSkill.h"
+#include "Algo/Reverse.h"
+#include "Async/Async.h"
+#include "Engine/GameInstance.h"
+#include "Kismet/GameplayStatics.h"
+
+namespace ConceptAcquisitionPlanner
+{
+	static constexpr int32 NumTiers = 4;
+
+	// Floor on acquisition chance, so concepts that can (almost) never be acquired get a large but finite cost
+	static constexpr float MinAcquisitionChance = 0.01f;
+
+	static uint64 Bit(int32 Index)
+	{
+		return uint64(1) << Index;
+	}
+
+	// Body part TryAcquireConcept prefers for a tier
+	static EBodyPartType GetPreferredBodyPart(EConceptTier Tier)
+	{
+		switch (Tier)
+		{
+		case EConceptTier::Abstract:
+			return EBodyPartType::Head;
+		case EConceptTier::Advanced:
+			return EBodyPartType::Body;
+		case EConceptTier::Intermediate:
+			return EBodyPartType::Arms;
+		case EConceptTier::Physical:
+			return EBodyPartType::Feet;
+		default:
+			return EBodyPartType::Body;
+		}
+	}
+
+	// A state on the open list
+	struct FOpenEntry
+	{
+		float F;
+		float G;
+		float H;
+		uint64 State;
+	};
+
+	// Best known way to reach a state
+	struct FNode
+	{
+		float G;
+
+		// Candidate acquired last on the way here (INDEX_NONE for the start)
+		int8 Last;
+		bool bClosed;
+	};
+}
+
+bool UConceptAcquisitionPlanner::FProblem::operator==(const FProblem& Other) const
+{
+	return CatalogVersion == Other.CatalogVersion
+		&& SkillIndex == Other.SkillIndex
+		&& NumRequired == Other.NumRequired
+		&& Discovered == Other.Discovered
+		&& FMemory::Memcmp(FreeSlots, Other.FreeSlots, sizeof(FreeSlots)) == 0
+		&& UndiscoveredCostScale == Other.UndiscoveredCostScale
+		&& MaxExpansions == Other.MaxExpansions
+		&& MaxNodes == Other.MaxNodes
+		&& Candidates == Other.Candidates
+		&& Costs.Num() == Other.Costs.Num()
+		&& FMemory::Memcmp(Costs.GetData(), Other.Costs.GetData(), Costs.Num() * sizeof(float)) == 0;
+}
+
+uint32 GetTypeHash(const UConceptAcquisitionPlanner::FProblem& Problem)
+{
+	// Tiers and enablers follow from the candidates and the catalog version; costs come from each candidate asset's
+	// AcquisitionDifficulty and BaseAcquisitionChance, which can change without a new catalog, so they are hashed
+	// bitwise to match operator==
+	uint32 Hash = HashCombine(Problem.CatalogVersion, GetTypeHash(Problem.SkillIndex));
+	Hash = HashCombine(Hash, GetTypeHash(Problem.Discovered));
+	Hash = FCrc::MemCrc32(Problem.FreeSlots, sizeof(Problem.FreeSlots), Hash);
+	Hash = FCrc::MemCrc32(Problem.Costs.GetData(), Problem.Costs.Num() * sizeof(float), Hash);
+	return FCrc::MemCrc32(Problem.Candidates.GetData(), Problem.Candidates.Num() * sizeof(int32), Hash);
+}
+
+UConceptAcquisitionPlanner::UConceptAcquisitionPlanner()
+{
+	UndiscoveredCostScale = 4.0f;
+	MaxExpansions = 20000;
+	MaxSearchNodes = 100000;
+	MaxMemoizedPlans = 256;
+	MemoCatalogVersion = 0;
+}
+
+void UConceptAcquisitionPlanner::Deinitialize()
+{
+	// Searches still running finish into a dead weak pointer and are dropped
+	InFlight.Empty();
+	Memo.Empty();
+
+	Super::Deinitialize();
+}
+
+UConceptAcquisitionPlanner* UConceptAcquisitionPlanner::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+	return GameInstance ? GameInstance->GetSubsystem<UConceptAcquisitionPlanner>() : nullptr;
+}
+
+void UConceptAcquisitionPlanner::RequestPlan(UConceptComponent* Component, UConceptSkill* Skill, FOnAcquisitionPlanReady OnReady)
+{
+	RequestPlan(Component, Skill, [OnReady](const FConceptAcquisitionPlan& Plan)
+	{
+		OnReady.ExecuteIfBound(Plan);
+	});
+}
+
+void UConceptAcquisitionPlanner::RequestPlan(UConceptComponent* Component, UConceptSkill* Skill, TFunction<void(const FConceptAcquisitionPlan&)> OnReady)
+{
+	check(IsInGameThread());
+
+	if (!OnReady)
+	{
+		return;
+	}
+
+	SyncCatalogVersion();
+
+	FProblem Problem;
+	FSearchResult Result;
+	TArray<FFreeSlot> FreeSlots;
+	if (!Component || !Skill || !BuildProblem(Component, Skill, Problem, Result, FreeSlots))
+	{
+		FConceptAcquisitionPlan Plan;
+		Plan.TargetSkill = Skill;
+		OnReady(Plan);
+		return;
+	}
+
+	// Nothing missing: the empty plan is the answer
+	if (Problem.NumRequired == 0)
+	{
+		Result.bFound = true;
+		OnReady(MakePlan(Problem, Result, FreeSlots));
+		return;
+	}
+
+	if (const FSearchResult* Memoized = Memo.Find(Problem))
+	{
+		OnReady(MakePlan(Problem, *Memoized, FreeSlots));
+		return;
+	}
+
+	if (TArray<FWaiter>* Waiters = InFlight.Find(Problem))
+	{
+		Waiters->Add({ MoveTemp(OnReady), MoveTemp(FreeSlots) });
+		return;
+	}
+
+	InFlight.Add(Problem).Add({ MoveTemp(OnReady), MoveTemp(FreeSlots) });
+
+	// The problem holds no UObjects, so the search is safe on any thread
+	TWeakObjectPtr<UConceptAcquisitionPlanner> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Problem, Result = MoveTemp(Result)]() mutable
+	{
+		Search(Problem, Result.Order, Result.TotalCost, Result.Expansions, Result.bFound);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Problem = MoveTemp(Problem), Result = MoveTemp(Result)]()
+		{
+			if (UConceptAcquisitionPlanner* Planner = WeakThis.Get())
+			{
+				Planner->FinishSearch(Problem, Result);
+			}
+		});
+	});
+}
+
+void UConceptAcquisitionPlanner::ClearMemo()
+{
+	Memo.Reset();
+}
+
+void UConceptAcquisitionPlanner::SyncCatalogVersion()
+{
+	const uint32 CatalogVersion = FConceptCatalog::GetPublished().Version;
+	if (CatalogVersion != MemoCatalogVersion)
+	{
+		Memo.Reset();
+		MemoCatalogVersion = CatalogVersion;
+	}
+}
+
+void UConceptAcquisitionPlanner::FinishSearch(const FProblem& Problem, const FSearchResult& Result)
+{
+	SyncCatalogVersion();
+
+	// Plans against a replaced catalog still answer their callers, but aren't kept
+	if (Problem.CatalogVersion == MemoCatalogVersion && MaxMemoizedPlans > 0)
+	{
+		if (Memo.Num() >= MaxMemoizedPlans)
+		{
+			Memo.Reset();
+		}
+		Memo.Add(Problem, Result);
+	}
+
+	TArray<FWaiter> Waiters;
+	if (InFlight.RemoveAndCopyValue(Problem, Waiters))
+	{
+		for (const FWaiter& Waiter : Waiters)
+		{
+			Waiter.Callback(MakePlan(Problem, Result, Waiter.FreeSlots));
+		}
+	}
+}
+
+bool UConceptAcquisitionPlanner::BuildProblem(UConceptComponent* Component, UConceptSkill* Skill, FProblem& OutProblem, FSearchResult& OutResult, TArray<FFreeSlot>& OutFreeSlots) const
+{
+	using namespace ConceptAcquisitionPlanner;
+
+	const FConceptCatalog& Catalog = FConceptCatalog::GetPublished();
+	OutProblem.CatalogVersion = Catalog.Version;
+	OutProblem.SkillIndex = Catalog.GetSkillIndex(FSoftObjectPath(Skill));
+	OutProblem.UndiscoveredCostScale = FMath::Max(UndiscoveredCostScale, 1.0f);
+	OutProblem.MaxExpansions = FMath::Max(MaxExpansions, 1);
+	OutProblem.MaxNodes = FMath::Max(MaxSearchNodes, 1);
+	OutResult.Skill = Skill;
+
+	if (OutProblem.SkillIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TArray<uint64> Acquired;
+	Acquired.SetNumZeroed(Catalog.MaskWords);
+	TArray<int32> AcquiredIndices;
+	for (const TSoftObjectPtr<UConcept>& Concept : Component->AcquiredConcepts)
+	{
+		const int32 Index = Catalog.GetConceptIndex(Concept.ToSoftObjectPath());
+		if (Index != INDEX_NONE)
+		{
+			Acquired[Index >> 6] |= Bit(Index & 63);
+			AcquiredIndices.Add(Index);
+		}
+	}
+
+	auto IsAcquired = [&Acquired](int32 Index) { return (Acquired[Index >> 6] >> (Index & 63)) & 1; };
+
+	// The goal is every concept the requirement expression needs outside a NOT; for OR and N-of-M groups that is
+	// enough but more than the cheapest way to meet them
+	const FConceptRequirementProgram& Program = Skill->GetRequirementProgram();
+	if (!Program.IsConjunction())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Planning %s for all of its concepts; its requirement expression may be met with fewer"), *Skill->GetName());
+	}
+
+	TArray<FSoftObjectPath> RequiredPaths;
+	Program.GetPositiveConcepts(RequiredPaths);
+
+	// Missing requirements come first, so the goal is the low NumRequired bits
+	for (const FSoftObjectPath& Required : RequiredPaths)
+	{
+		const int32 Index = Catalog.GetConceptIndex(Required);
+		if (Index == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Cannot plan %s: required concept %s is not in the concept catalog"), *Skill->GetName(), *Required.ToString());
+			return false;
+		}
+
+		if (!IsAcquired(Index) && !OutProblem.Candidates.Contains(Index))
+		{
+			if (OutProblem.Candidates.Num() == MaxCandidates)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Cannot plan %s: more than %d required concepts are missing"), *Skill->GetName(), MaxCandidates);
+				return false;
+			}
+			OutProblem.Candidates.Add(Index);
+		}
+	}
+	OutProblem.NumRequired = OutProblem.Candidates.Num();
+
+	if (OutProblem.NumRequired > 0)
+	{
+		// Concepts known or related to something known, nearest first: acquired ones are sources, observed ones are
+		// sources and candidates
+		TArray<uint64> Reached = Acquired;
+		TArray<int32> Frontier = AcquiredIndices;
+		for (const TSoftObjectPtr<UConcept>& Concept : Component->ObservedConcepts)
+		{
+			const int32 Index = Catalog.GetConceptIndex(Concept.ToSoftObjectPath());
+			if (Index != INDEX_NONE && !((Reached[Index >> 6] >> (Index & 63)) & 1))
+			{
+				Reached[Index >> 6] |= Bit(Index & 63);
+				Frontier.Add(Index);
+			}
+		}
+
+		for (int32 Head = 0; Head < Frontier.Num(); ++Head)
+		{
+			for (const uint32 Next : Catalog.GetRelatedConcepts(Frontier[Head]))
+			{
+				if (!((Reached[Next >> 6] >> (Next & 63)) & 1))
+				{
+					Reached[Next >> 6] |= Bit(Next & 63);
+					Frontier.Add(Next);
+				}
+			}
+		}
+
+		// Only concepts that lead to a missing requirement can make the plan cheaper; repeat the backward pass until
+		// nothing changes, since cycles can hide a useful concept behind one visited earlier
+		TSet<int32> Useful;
+		for (int32 Position = 0; Position < OutProblem.NumRequired; ++Position)
+		{
+			Useful.Add(OutProblem.Candidates[Position]);
+		}
+
+		bool bChanged = true;
+		while (bChanged)
+		{
+			bChanged = false;
+			for (int32 Position = Frontier.Num() - 1; Position >= 0; --Position)
+			{
+				const int32 Concept = Frontier[Position];
+				if (Useful.Contains(Concept) || IsAcquired(Concept))
+				{
+					continue;
+				}
+
+				for (const uint32 Next : Catalog.GetRelatedConcepts(Concept))
+				{
+					if (Useful.Contains(Next))
+					{
+						Useful.Add(Concept);
+						bChanged = true;
+						break;
+					}
+				}
+			}
+		}
+
+		// Intermediates in breadth-first order until the state is full
+		for (const int32 Concept : Frontier)
+		{
+			if (OutProblem.Candidates.Num() == MaxCandidates)
+			{
+				break;
+			}
+
+			if (!IsAcquired(Concept) && Useful.Contains(Concept) && !OutProblem.Candidates.Contains(Concept))
+			{
+				OutProblem.Candidates.Add(Concept);
+			}
+		}
+	}
+
+	TMap<int32, int32> PositionByConcept;
+	for (int32 Position = 0; Position < OutProblem.Candidates.Num(); ++Position)
+	{
+		const int32 Concept = OutProblem.Candidates[Position];
+		PositionByConcept.Add(Concept, Position);
+
+		const TSoftObjectPtr<UConcept>& SoftConcept = Catalog.Concepts[Concept];
+		OutResult.Concepts.Add(SoftConcept);
+		OutProblem.Tiers.Add(Catalog.ConceptTiers[Concept]);
+
+		// Expected attempts times difficulty; the Gameplay bundle the catalog loads holds both fields
+		const UConcept* Loaded = SoftConcept.Get();
+		const float Difficulty = Loaded ? FMath::Max(Loaded->AcquisitionDifficulty, 1) : 1.0f;
+		const float Chance = Loaded ? FMath::Max(Loaded->BaseAcquisitionChance, MinAcquisitionChance) : 1.0f;
+		OutProblem.Costs.Add(Difficulty / Chance);
+	}
+
+	OutProblem.Enablers.SetNumZeroed(OutProblem.Candidates.Num());
+	for (int32 Position = 0; Position < OutProblem.Candidates.Num(); ++Position)
+	{
+		for (const uint32 Next : Catalog.GetRelatedConcepts(OutProblem.Candidates[Position]))
+		{
+			if (const int32* Enabled = PositionByConcept.Find(Next))
+			{
+				OutProblem.Enablers[*Enabled] |= Bit(Position);
+			}
+		}
+	}
+
+	for (const int32 Concept : AcquiredIndices)
+	{
+		for (const uint32 Next : Catalog.GetRelatedConcepts(Concept))
+		{
+			if (const int32* Enabled = PositionByConcept.Find(Next))
+			{
+				OutProblem.Discovered |= Bit(*Enabled);
+			}
+		}
+	}
+
+	for (const TSoftObjectPtr<UConcept>& Concept : Component->ObservedConcepts)
+	{
+		if (const int32* Observed = PositionByConcept.Find(Catalog.GetConceptIndex(Concept.ToSoftObjectPath())))
+		{
+			OutProblem.Discovered |= Bit(*Observed);
+		}
+	}
+
+	for (const FConceptSlot& Slot : Component->Slots.Items)
+	{
+		if (Slot.bIsUnlocked && Slot.IsEmpty())
+		{
+			OutFreeSlots.Add({ Slot.BodyPart, Slot.MaxTier });
+			++OutProblem.FreeSlots[FMath::Clamp(static_cast<int32>(Slot.MaxTier), 0, NumTiers - 1)];
+		}
+	}
+
+	return true;
+}
+
+void UConceptAcquisitionPlanner::Search(const FProblem& Problem, TArray<int32>& OutOrder, float& OutTotalCost, int32& OutExpansions, bool& bOutFound)
+{
+	using namespace ConceptAcquisitionPlanner;
+
+	OutOrder.Reset();
+	OutTotalCost = 0.0f;
+	OutExpansions = 0;
+	bOutFound = false;
+
+	const int32 NumCandidates = Problem.Candidates.Num();
+	const uint64 GoalMask = Problem.NumRequired == MaxCandidates ? ~uint64(0) : Bit(Problem.NumRequired) - 1;
+
+	// Concepts of tier T or above can only go into slots of max tier T or above; checking that for every T is enough
+	// for some assignment of concepts to slots to exist
+	uint64 TierAtLeast[NumTiers] = {};
+	int32 SlotsAtLeast[NumTiers] = {};
+	for (int32 Tier = NumTiers - 1; Tier >= 0; --Tier)
+	{
+		SlotsAtLeast[Tier] = Problem.FreeSlots[Tier] + (Tier + 1 < NumTiers ? SlotsAtLeast[Tier + 1] : 0);
+		for (int32 Position = 0; Position < NumCandidates; ++Position)
+		{
+			if (Problem.Tiers[Position] >= Tier)
+			{
+				TierAtLeast[Tier] |= Bit(Position);
+			}
+		}
+	}
+
+	auto Fits = [&TierAtLeast, &SlotsAtLeast](uint64 State)
+	{
+		for (int32 Tier = 0; Tier < NumTiers; ++Tier)
+		{
+			if (FMath::CountBits(State & TierAtLeast[Tier]) > SlotsAtLeast[Tier])
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	if (!Fits(GoalMask))
+	{
+		return;
+	}
+
+	// Candidates each candidate discovers; an intermediate is only worth acquiring while it discovers something new
+	uint64 Discovers[MaxCandidates] = {};
+	for (int32 Position = 0; Position < NumCandidates; ++Position)
+	{
+		for (uint64 Enablers = Problem.Enablers[Position]; Enablers; Enablers &= Enablers - 1)
+		{
+			Discovers[FMath::CountTrailingZeros64(Enablers)] |= Bit(Position);
+		}
+	}
+
+	// Every missing requirement costs at least its discovered cost, so the sum never overestimates; acquiring one
+	// lowers it by no more than the step costs, so it is also consistent and closed states are final
+	float StartH = 0.0f;
+	for (int32 Position = 0; Position < Problem.NumRequired; ++Position)
+	{
+		StartH += Problem.Costs[Position];
+	}
+
+	auto OpenLess = [](const FOpenEntry& A, const FOpenEntry& B) { return A.F < B.F || (A.F == B.F && A.G > B.G); };
+
+	TArray<FOpenEntry> Open;
+	TMap<uint64, FNode> Nodes;
+	Open.HeapPush({ StartH, 0.0f, StartH, 0 }, OpenLess);
+	Nodes.Add(0, { 0.0f, INDEX_NONE, false });
+
+	while (Open.Num() > 0)
+	{
+		FOpenEntry Entry;
+		Open.HeapPop(Entry, OpenLess, false);
+
+		FNode& Node = Nodes[Entry.State];
+		if (Node.bClosed || Entry.G > Node.G)
+		{
+			continue;
+		}
+		Node.bClosed = true;
+		++OutExpansions;
+
+		if ((Entry.State & GoalMask) == GoalMask)
+		{
+			bOutFound = true;
+			OutTotalCost = Entry.G;
+			for (uint64 State = Entry.State; State != 0;)
+			{
+				const int32 Last = Nodes[State].Last;
+				OutOrder.Add(Last);
+				State &= ~Bit(Last);
+			}
+			Algo::Reverse(OutOrder);
+			return;
+		}
+
+		// Give up rather than let the open list and node map grow without bound
+		if (OutExpansions >= Problem.MaxExpansions || Nodes.Num() >= Problem.MaxNodes)
+		{
+			return;
+		}
+
+		uint64 DiscoveredNow = Problem.Discovered;
+		for (uint64 Acquired = Entry.State; Acquired; Acquired &= Acquired - 1)
+		{
+			DiscoveredNow |= Discovers[FMath::CountTrailingZeros64(Acquired)];
+		}
+
+		for (int32 Position = 0; Position < NumCandidates; ++Position)
+		{
+			const uint64 Next = Entry.State | Bit(Position);
+			if (Next == Entry.State)
+			{
+				continue;
+			}
+
+			if (Position >= Problem.NumRequired && (Discovers[Position] & ~Next & ~DiscoveredNow) == 0)
+			{
+				continue;
+			}
+
+			if (!Fits(Next))
+			{
+				continue;
+			}
+
+			const float StepCost = (DiscoveredNow & Bit(Position)) ? Problem.Costs[Position] : Problem.Costs[Position] * Problem.UndiscoveredCostScale;
+			const float G = Entry.G + StepCost;
+			FNode* Existing = Nodes.Find(Next);
+			if (Existing && (Existing->bClosed || Existing->G <= G))
+			{
+				continue;
+			}
+
+			if (Existing)
+			{
+				Existing->G = G;
+				Existing->Last = Position;
+			}
+			else
+			{
+				Nodes.Add(Next, { G, static_cast<int8>(Position), false });
+			}
+
+			const float H = Position < Problem.NumRequired ? Entry.H - Problem.Costs[Position] : Entry.H;
+			Open.HeapPush({ G + H, G, H, Next }, OpenLess);
+		}
+	}
+}
+
+FConceptAcquisitionPlan UConceptAcquisitionPlanner::MakePlan(const FProblem& Problem, const FSearchResult& Result, const TArray<FFreeSlot>& FreeSlots)
+{
+	using namespace ConceptAcquisitionPlanner;
+
+	FConceptAcquisitionPlan Plan;
+	Plan.TargetSkill = Result.Skill;
+	Plan.bFound = Result.bFound;
+	Plan.Expansions = Result.Expansions;
+	if (!Result.bFound)
+	{
+		return Plan;
+	}
+
+	uint64 State = 0;
+	for (const int32 Position : Result.Order)
+	{
+		FConceptAcquisitionStep& Step = Plan.Steps.AddDefaulted_GetRef();
+		Step.Concept = Result.Concepts[Position];
+		Step.bDiscovered = ((Problem.Discovered & Bit(Position)) != 0) || (Problem.Enablers[Position] & State) != 0;
+		Step.Cost = Step.bDiscovered ? Problem.Costs[Position] : Problem.Costs[Position] * Problem.UndiscoveredCostScale;
+		Plan.TotalCost += Step.Cost;
+		State |= Bit(Position);
+	}
+
+	// Highest tiers first, each into the lowest slot that holds it; the search made sure this never runs out
+	TArray<int32> ByTier;
+	for (int32 StepIndex = 0; StepIndex < Plan.Steps.Num(); ++StepIndex)
+	{
+		ByTier.Add(StepIndex);
+	}
+	ByTier.Sort([&Problem, &Result](int32 A, int32 B) { return Problem.Tiers[Result.Order[A]] > Problem.Tiers[Result.Order[B]]; });
+
+	TArray<bool> Taken;
+	Taken.SetNumZeroed(FreeSlots.Num());
+	for (const int32 StepIndex : ByTier)
+	{
+		FConceptAcquisitionStep& Step = Plan.Steps[StepIndex];
+		const EConceptTier Tier = static_cast<EConceptTier>(Problem.Tiers[Result.Order[StepIndex]]);
+		const EBodyPartType Preferred = GetPreferredBodyPart(Tier);
+
+		int32 Best = INDEX_NONE;
+		for (int32 SlotIndex = 0; SlotIndex < FreeSlots.Num(); ++SlotIndex)
+		{
+			const FFreeSlot& Slot = FreeSlots[SlotIndex];
+			if (Taken[SlotIndex] || Slot.MaxTier < Tier)
+			{
+				continue;
+			}
+
+			if (Best == INDEX_NONE || Slot.MaxTier < FreeSlots[Best].MaxTier
+				|| (Slot.MaxTier == FreeSlots[Best].MaxTier && Slot.BodyPart == Preferred && FreeSlots[Best].BodyPart != Preferred))
+			{
+				Best = SlotIndex;
+			}
+		}
+
+		if (Best != INDEX_NONE)
+		{
+			Taken[Best] = true;
+			Step.BodyPart = FreeSlots[Best].BodyPart;
+			Step.SlotTier = FreeSlots[Best].MaxTier;
+		}
+	}
+
+	return Plan;
+}
@@ -0,0 +1,781 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptCatalog.h"
+#include "ConceptCatalogFile.h"
+#include "ConceptGraph.h"
+#include "Engine/AssetManager.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+#if WITH_EDITOR
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/UObjectGlobals.h"
+#endif
+
+namespace ConceptCatalogPublishing
+{
+	// Version of the next catalog built; declared before EmptyCatalog, which takes the first one
+	static std::atomic<uint32> NextVersion(1);
+
+	// What readers see; swapped atomically, only ever by the game thread
+	static std::atomic<const FConceptCatalog*> Published(nullptr);
+
+	// Keeps the published catalog alive; written by the game thread under PublishedLock, which GetShared also takes
+	static TSharedPtr<const FConceptCatalog, ESPMode::ThreadSafe> PublishedOwner;
+	static FCriticalSection PublishedLock;
+
+	// Returned while nothing is published
+	static const FConceptCatalog EmptyCatalog{};
+
+	// Replaced catalogs and the frame they were replaced in, freed once unreferenced after that frame (game thread)
+	static TArray<TPair<TSharedPtr<const FConceptCatalog, ESPMode::ThreadSafe>, uint64>> Retired;
+
+	static FTSTicker::FDelegateHandle ReclaimHandle;
+
+	// Changes not yet built, and whether a build is running (game thread)
+	static FConceptCatalogDelta PendingDelta;
+	static bool bBuildInFlight = false;
+
+	// Bumped by full rebuilds and shutdown, so stale off-thread builds are dropped
+	static uint32 Generation = 0;
+
+#if WITH_EDITOR
+	static FDelegateHandle PropertyChangedHandle;
+	static FDelegateHandle AssetAddedHandle;
+	static FDelegateHandle AssetRemovedHandle;
+	static FDelegateHandle AssetRenamedHandle;
+#endif
+}
+
+void FConceptCatalogDelta::Append(FConceptCatalogDelta&& Other)
+{
+	auto RemoveRecord = [](TArray<FConceptCatalogAssetRecord>& Records, const FSoftObjectPath& Path)
+	{
+		Records.RemoveAll([&Path](const FConceptCatalogAssetRecord& Record) { return Record.Path == Path; });
+	};
+
+	for (const FSoftObjectPath& Path : Other.Removed)
+	{
+		RemoveRecord(Concepts, Path);
+		RemoveRecord(Skills, Path);
+		Removed.AddUnique(Path);
+	}
+
+	for (FConceptCatalogAssetRecord& Record : Other.Concepts)
+	{
+		Removed.Remove(Record.Path);
+		RemoveRecord(Concepts, Record.Path);
+		Concepts.Add(MoveTemp(Record));
+	}
+
+	for (FConceptCatalogAssetRecord& Record : Other.Skills)
+	{
+		Removed.Remove(Record.Path);
+		RemoveRecord(Skills, Record.Path);
+		Skills.Add(MoveTemp(Record));
+	}
+}
+
+FConceptCatalog::FConceptCatalog()
+{
+	Version = ConceptCatalogPublishing::NextVersion.fetch_add(1);
+}
+
+int32 FConceptCatalog::GetConceptIndex(const FSoftObjectPath& Path) const
+{
+	if (File.IsValid())
+	{
+		return File->FindConcept(Path);
+	}
+
+	const int32* Index = ConceptIndexByPath.Find(Path);
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 FConceptCatalog::GetSkillIndex(const FSoftObjectPath& Path) const
+{
+	if (File.IsValid())
+	{
+		return File->FindSkill(Path);
+	}
+
+	const int32* Index = SkillIndexByPath.Find(Path);
+	return Index ? *Index : INDEX_NONE;
+}
+
+const FConceptCatalog& FConceptCatalog::Get()
+{
+	check(IsInGameThread());
+
+	if (!ConceptCatalogPublishing::PublishedOwner.IsValid())
+	{
+		Publish(Build());
+
+#if WITH_EDITOR
+		StartWatchingAssets();
+#endif
+	}
+
+	return GetPublished();
+}
+
+const FConceptCatalog& FConceptCatalog::GetPublished()
+{
+	checkSlow(IsInGameThread());
+
+	const FConceptCatalog* Current = ConceptCatalogPublishing::Published.load(std::memory_order_relaxed);
+	return Current ? *Current : ConceptCatalogPublishing::EmptyCatalog;
+}
+
+TSharedRef<const FConceptCatalog, ESPMode::ThreadSafe> FConceptCatalog::GetShared()
+{
+	{
+		FScopeLock Lock(&ConceptCatalogPublishing::PublishedLock);
+		if (ConceptCatalogPublishing::PublishedOwner.IsValid())
+		{
+			return ConceptCatalogPublishing::PublishedOwner.ToSharedRef();
+		}
+	}
+
+	static const TSharedRef<const FConceptCatalog, ESPMode::ThreadSafe> EmptyShared = MakeShared<FConceptCatalog, ESPMode::ThreadSafe>();
+	return EmptyShared;
+}
+
+void FConceptCatalog::Rebuild()
+{
+	check(IsInGameThread());
+
+	// A full scan includes every pending change, and supersedes any build still running
+	++ConceptCatalogPublishing::Generation;
+	ConceptCatalogPublishing::PendingDelta = FConceptCatalogDelta();
+	ConceptCatalogPublishing::bBuildInFlight = false;
+
+	Publish(Build());
+}
+
+void FConceptCatalog::QueueRefresh(const TArray<FSoftObjectPath>& ChangedAssets, const TArray<FSoftObjectPath>& RemovedAssets)
+{
+	check(IsInGameThread());
+
+	// Nothing to refresh before the first build; it will see the current assets anyway
+	if (!ConceptCatalogPublishing::PublishedOwner.IsValid())
+	{
+		return;
+	}
+
+	// Loading and reading the assets has to happen here; only the captured records go to the worker
+	TArray<FPrimaryAssetId> AssetIds;
+	for (const FSoftObjectPath& Path : ChangedAssets)
+	{
+		AssetIds.Add(UAssetManager::Get().GetPrimaryAssetIdForPath(Path));
+	}
+	LoadCatalogAssets(ChangedAssets, AssetIds);
+
+	FConceptCatalogDelta Delta;
+	Delta.Removed = RemovedAssets;
+	for (const FSoftObjectPath& Path : ChangedAssets)
+	{
+		if (!CaptureRecord(Path, Delta))
+		{
+			// Deleted, or no longer a concept or skill
+			Delta.Removed.AddUnique(Path);
+		}
+	}
+
+	ConceptCatalogPublishing::PendingDelta.Append(MoveTemp(Delta));
+	StartPendingBuild();
+}
+
+bool FConceptCatalog::IsRefreshPending()
+{
+	return ConceptCatalogPublishing::bBuildInFlight || !ConceptCatalogPublishing::PendingDelta.IsEmpty();
+}
+
+void FConceptCatalog::StartPendingBuild()
+{
+	using namespace ConceptCatalogPublishing;
+
+	if (bBuildInFlight || PendingDelta.IsEmpty())
+	{
+		return;
+	}
+
+	bBuildInFlight = true;
+
+	// The worker holds its own reference to the base catalog, so it outlives any publish meanwhile
+	TSharedPtr<const FConceptCatalog, ESPMode::ThreadSafe> Base = PublishedOwner;
+	TSharedRef<FConceptCatalogDelta, ESPMode::ThreadSafe> Delta = MakeShared<FConceptCatalogDelta, ESPMode::ThreadSafe>(MoveTemp(PendingDelta));
+	PendingDelta = FConceptCatalogDelta();
+	const uint32 BuildGeneration = Generation;
+
+	Async(EAsyncExecution::ThreadPool, [Base, Delta, BuildGeneration]()
+	{
+		TSharedRef<const FConceptCatalog, ESPMode::ThreadSafe> NewCatalog = BuildFromDelta(Base.Get(), *Delta);
+
+		AsyncTask(ENamedThreads::GameThread, [NewCatalog, BuildGeneration]()
+		{
+			if (BuildGeneration != Generation)
+			{
+				return;
+			}
+
+			bBuildInFlight = false;
+			Publish(NewCatalog);
+
+			// Changes that came in while this one was building
+			StartPendingBuild();
+		});
+	});
+}
+
+void FConceptCatalog::Publish(TSharedRef<const FConceptCatalog, ESPMode::ThreadSafe> NewCatalog)
+{
+	using namespace ConceptCatalogPublishing;
+	check(IsInGameThread());
+
+	// Game-thread code may still hold a reference from earlier this frame, so the old catalog is retired rather than freed
+	Published.store(&NewCatalog.Get());
+	if (PublishedOwner.IsValid())
+	{
+		Retired.Emplace(PublishedOwner, GFrameCounter);
+	}
+
+	{
+		FScopeLock Lock(&PublishedLock);
+		PublishedOwner = NewCatalog;
+	}
+
+	if (Retired.Num() > 0 && !ReclaimHandle.IsValid())
+	{
+		ReclaimHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FConceptCatalog::ReclaimRetired));
+	}
+}
+
+bool FConceptCatalog::ReclaimRetired(float DeltaTime)
+{
+	using namespace ConceptCatalogPublishing;
+
+	// Get references end with their frame; a GetShared or off-thread build reference is one more owner than Retired's.
+	// Retired is only changed on the game thread, so a count of one can't go back up while it is checked.
+	Retired.RemoveAll([](const TPair<TSharedPtr<const FConceptCatalog, ESPMode::ThreadSafe>, uint64>& Entry)
+	{
+		return Entry.Value < GFrameCounter && Entry.Key.GetSharedReferenceCount() == 1;
+	});
+
+	if (Retired.Num() > 0)
+	{
+		return true;
+	}
+
+	ReclaimHandle.Reset();
+	return false;
+}
+
+void FConceptCatalog::Release()
+{
+	using namespace ConceptCatalogPublishing;
+
+#if WITH_EDITOR
+	StopWatchingAssets();
+#endif
+
+	if (ReclaimHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ReclaimHandle);
+		ReclaimHandle.Reset();
+	}
+
+	// Module shutdown: no readers are left, and builds still running are dropped
+	++Generation;
+	bBuildInFlight = false;
+	PendingDelta = FConceptCatalogDelta();
+	Published.store(nullptr);
+	{
+		FScopeLock Lock(&PublishedLock);
+		PublishedOwner.Reset();
+	}
+	Retired.Empty();
+}
+
+TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> FConceptCatalog::Build()
+{
+#if !WITH_EDITOR
+	// Cooked builds use the catalog the cook step wrote; the scan stays as a fallback if it wasn't staged.
+	// Staleness against the cooked content is checked by the commandlet's -VerifyCooked pass, not at startup.
+	if (TSharedPtr<FConceptCatalogFile, ESPMode::ThreadSafe> CookedFile = FConceptCatalogFile::Map(FConceptCatalogFile::GetDefaultPath()))
+	{
+		return BuildFromFile(CookedFile.ToSharedRef());
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("ConceptCatalog: No cooked catalog at %s, scanning the asset registry"), *FConceptCatalogFile::GetDefaultPath());
+#endif
+
+	return BuildFromAssetRegistry();
+}
+
+void FConceptCatalog::GatherCatalogAssets(TArray<FSoftObjectPath>& OutPaths, TArray<FPrimaryAssetId>& OutAssetIds)
+{
+	IAssetRegistry& AssetRegistry = UAssetManager::Get().GetAssetRegistry();
+
+	// Use asset manager to find all concept and skill assets
+	TArray<FAssetData> AssetData;
+	FARFilter Filter;
+	Filter.ClassNames.Add(UConcept::StaticClass()->GetFName());
+	Filter.ClassNames.Add(UConceptSkill::StaticClass()->GetFName());
+	Filter.bRecursiveClasses = true;
+	AssetRegistry.GetAssets(Filter, AssetData);
+
+	OutPaths.Reset(AssetData.Num());
+	OutAssetIds.Reset(AssetData.Num());
+	for (const FAssetData& Asset : AssetData)
+	{
+		OutPaths.Add(Asset.ToSoftObjectPath());
+		OutAssetIds.Add(Asset.GetPrimaryAssetId());
+	}
+}
+
+TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> FConceptCatalog::BuildFromAssetRegistry()
+{
+	// Load gameplay data only; icons and other UI data stay on disk until requested
+	TArray<FSoftObjectPath> Paths;
+	TArray<FPrimaryAssetId> AssetIds;
+	GatherCatalogAssets(Paths, AssetIds);
+	LoadCatalogAssets(Paths, AssetIds);
+
+	// A full scan is a delta against nothing; assets that failed to load are left out
+	FConceptCatalogDelta Delta;
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		CaptureRecord(Path, Delta);
+	}
+
+	TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> Catalog = BuildFromDelta(nullptr, Delta);
+
+	UE_LOG(LogTemp, Log, TEXT("ConceptCatalog: Scanned %d concepts, %d skills (hash %08x)"), Catalog->Concepts.Num(), Catalog->Skills.Num(), Catalog->Hash);
+	return Catalog;
+}
+
+TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> FConceptCatalog::BuildFromFile(const TSharedRef<FConceptCatalogFile, ESPMode::ThreadSafe>& InFile)
+{
+	TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> Catalog = MakeShared<FConceptCatalog, ESPMode::ThreadSafe>();
+	Catalog->File = InFile;
+
+	const FConceptCatalogFileHeader& Header = InFile->GetHeader();
+	const TConstArrayView<FConceptCatalogFileEntry> ConceptEntries = InFile->GetConcepts();
+	const TConstArrayView<FConceptCatalogFileEntry> SkillEntries = InFile->GetSkills();
+
+	// The soft pointers the registry hands out are the only thing built here; every index is read in place
+	TArray<FSoftObjectPath> Paths;
+	TArray<FPrimaryAssetId> AssetIds;
+	Paths.Reserve(ConceptEntries.Num() + SkillEntries.Num());
+	AssetIds.Reserve(ConceptEntries.Num() + SkillEntries.Num());
+
+	Catalog->Concepts.Reserve(ConceptEntries.Num());
+	Catalog->ConceptTiers.Reserve(ConceptEntries.Num());
+	for (const FConceptCatalogFileEntry& Entry : ConceptEntries)
+	{
+		const FSoftObjectPath Path = InFile->GetPath(Entry);
+		Catalog->Concepts.Add(TSoftObjectPtr<UConcept>(Path));
+		Catalog->ConceptTiers.Add(static_cast<uint8>(Entry.Bucket));
+		Paths.Add(Path);
+		AssetIds.Add(FPrimaryAssetId(TEXT("Concept"), *Path.GetAssetName()));
+	}
+
+	Catalog->Skills.Reserve(SkillEntries.Num());
+	Catalog->SkillTypes.Reserve(SkillEntries.Num());
+	for (const FConceptCatalogFileEntry& Entry : SkillEntries)
+	{
+		const FSoftObjectPath Path = InFile->GetPath(Entry);
+		Catalog->Skills.Add(TSoftObjectPtr<UConceptSkill>(Path));
+		Catalog->SkillTypes.Add(static_cast<uint8>(Entry.Bucket));
+		Paths.Add(Path);
+		AssetIds.Add(FPrimaryAssetId(TEXT("ConceptSkill"), *Path.GetAssetName()));
+	}
+
+	LoadCatalogAssets(Paths, AssetIds);
+
+	const TConstArrayView<uint32> TierStarts = InFile->GetTierStarts();
+	const TConstArrayView<uint32> TierConcepts = InFile->GetTierConcepts();
+	for (uint32 Tier = 0; Tier < Header.NumTiers; ++Tier)
+	{
+		TArray<TSoftObjectPtr<UConcept>>& Bucket = Catalog->ConceptsByTier.Add(static_cast<EConceptTier>(Tier));
+		Bucket.Reserve(TierStarts[Tier + 1] - TierStarts[Tier]);
+		for (uint32 Index = TierStarts[Tier]; Index < TierStarts[Tier + 1]; ++Index)
+		{
+			Bucket.Add(Catalog->Concepts[TierConcepts[Index]]);
+		}
+	}
+
+	const TConstArrayView<uint32> TypeStarts = InFile->GetTypeStarts();
+	const TConstArrayView<uint32> TypeSkills = InFile->GetTypeSkills();
+	for (uint32 Type = 0; Type < Header.NumTypes; ++Type)
+	{
+		TArray<TSoftObjectPtr<UConceptSkill>>& Bucket = Catalog->SkillsByType.Add(static_cast<ESkillManifestationType>(Type));
+		Bucket.Reserve(TypeStarts[Type + 1] - TypeStarts[Type]);
+		for (uint32 Index = TypeStarts[Type]; Index < TypeStarts[Type + 1]; ++Index)
+		{
+			Bucket.Add(Catalog->Skills[TypeSkills[Index]]);
+		}
+	}
+
+	Catalog->Hash = Header.CatalogHash;
+	Catalog->MaskWords = Header.MaskWords;
+	Catalog->RequirementMasks = InFile->GetRequirementMasks();
+	Catalog->RelatedStarts = InFile->GetRelatedStarts();
+	Catalog->Related = InFile->GetRelated();
+
+	// Linear in concepts plus links, so it isn't worth a section of its own
+	Catalog->BuildReachability();
+
+	UE_LOG(LogTemp, Log, TEXT("ConceptCatalog: Mapped %d concepts, %d skills (hash %08x)"), Catalog->Concepts.Num(), Catalog->Skills.Num(), Catalog->Hash);
+	return Catalog;
+}
+
+TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> FConceptCatalog::BuildFromDelta(const FConceptCatalog* Previous, const FConceptCatalogDelta& Delta)
+{
+	TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> Catalog = MakeShared<FConceptCatalog, ESPMode::ThreadSafe>();
+
+	TMap<FSoftObjectPath, const FConceptCatalogAssetRecord*> ChangedConcepts;
+	for (const FConceptCatalogAssetRecord& Record : Delta.Concepts)
+	{
+		ChangedConcepts.Add(Record.Path, &Record);
+	}
+
+	TMap<FSoftObjectPath, const FConceptCatalogAssetRecord*> ChangedSkills;
+	for (const FConceptCatalogAssetRecord& Record : Delta.Skills)
+	{
+		ChangedSkills.Add(Record.Path, &Record);
+	}
+
+	const TSet<FSoftObjectPath> Removed(Delta.Removed);
+
+	// Surviving assets plus new ones; re-sorted only if the set changed, so unchanged catalogs keep their indices
+	auto GatherPaths = [&Removed](auto& PreviousPtrs, const TArray<FConceptCatalogAssetRecord>& Records, auto FindPrevious, TArray<FSoftObjectPath>& OutPaths)
+	{
+		bool bSetChanged = false;
+		for (const auto& Ptr : PreviousPtrs)
+		{
+			const FSoftObjectPath Path = Ptr.ToSoftObjectPath();
+			if (Removed.Contains(Path))
+			{
+				bSetChanged = true;
+			}
+			else
+			{
+				OutPaths.Add(Path);
+			}
+		}
+
+		for (const FConceptCatalogAssetRecord& Record : Records)
+		{
+			if (FindPrevious(Record.Path) == INDEX_NONE)
+			{
+				OutPaths.Add(Record.Path);
+				bSetChanged = true;
+			}
+		}
+
+		if (bSetChanged)
+		{
+			OutPaths.Sort([](const FSoftObjectPath& A, const FSoftObjectPath& B) { return A.ToString() < B.ToString(); });
+		}
+	};
+
+	static const TArray<TSoftObjectPtr<UConcept>> NoConcepts;
+	static const TArray<TSoftObjectPtr<UConceptSkill>> NoSkills;
+
+	TArray<FSoftObjectPath> ConceptPaths;
+	GatherPaths(Previous ? Previous->Concepts : NoConcepts, Delta.Concepts,
+		[Previous](const FSoftObjectPath& Path) { return Previous ? Previous->GetConceptIndex(Path) : INDEX_NONE; }, ConceptPaths);
+
+	TArray<FSoftObjectPath> SkillPaths;
+	GatherPaths(Previous ? Previous->Skills : NoSkills, Delta.Skills,
+		[Previous](const FSoftObjectPath& Path) { return Previous ? Previous->GetSkillIndex(Path) : INDEX_NONE; }, SkillPaths);
+
+	// Dense indices and the save-stability hash
+	Catalog->Concepts.Reserve(ConceptPaths.Num());
+	Catalog->ConceptIndexByPath.Reserve(ConceptPaths.Num());
+	for (int32 Index = 0; Index < ConceptPaths.Num(); ++Index)
+	{
+		Catalog->Concepts.Add(TSoftObjectPtr<UConcept>(ConceptPaths[Index]));
+		Catalog->ConceptIndexByPath.Add(ConceptPaths[Index], Index);
+		Catalog->Hash = FCrc::StrCrc32(*ConceptPaths[Index].ToString(), Catalog->Hash);
+	}
+
+	Catalog->Skills.Reserve(SkillPaths.Num());
+	Catalog->SkillIndexByPath.Reserve(SkillPaths.Num());
+	for (int32 Index = 0; Index < SkillPaths.Num(); ++Index)
+	{
+		Catalog->Skills.Add(TSoftObjectPtr<UConceptSkill>(SkillPaths[Index]));
+		Catalog->SkillIndexByPath.Add(SkillPaths[Index], Index);
+	}
+
+	// Where each previous concept ended up (INDEX_NONE if removed)
+	TArray<int32> ConceptRemap;
+	bool bConceptIndicesMoved = Previous == nullptr;
+	if (Previous)
+	{
+		ConceptRemap.SetNumUninitialized(Previous->Concepts.Num());
+		for (int32 OldIndex = 0; OldIndex < Previous->Concepts.Num(); ++OldIndex)
+		{
+			const int32* NewIndex = Catalog->ConceptIndexByPath.Find(Previous->Concepts[OldIndex].ToSoftObjectPath());
+			ConceptRemap[OldIndex] = NewIndex ? *NewIndex : INDEX_NONE;
+			bConceptIndicesMoved |= ConceptRemap[OldIndex] != OldIndex;
+		}
+		bConceptIndicesMoved |= Previous->Concepts.Num() != ConceptPaths.Num();
+	}
+
+	auto ResolveLink = [&Catalog](const FSoftObjectPath& Path)
+	{
+		const int32* Index = Catalog->ConceptIndexByPath.Find(Path);
+		return Index ? *Index : INDEX_NONE;
+	};
+
+	// Concept tiers and RelatedConcepts rows: re-read from changed records, remapped from the previous catalog otherwise
+	Catalog->ConceptTiers.SetNumZeroed(ConceptPaths.Num());
+	Catalog->RelatedStartStorage.Reserve(ConceptPaths.Num() + 1);
+	for (int32 Index = 0; Index < ConceptPaths.Num(); ++Index)
+	{
+		Catalog->RelatedStartStorage.Add(Catalog->RelatedStorage.Num());
+
+		if (const FConceptCatalogAssetRecord* const* Record = ChangedConcepts.Find(ConceptPaths[Index]))
+		{
+			Catalog->ConceptTiers[Index] = (*Record)->Bucket;
+			for (const FSoftObjectPath& Link : (*Record)->Links)
+			{
+				// Links to concepts outside the catalog are dropped
+				const int32 LinkIndex = ResolveLink(Link);
+				if (LinkIndex != INDEX_NONE)
+				{
+					Catalog->RelatedStorage.Add(LinkIndex);
+				}
+			}
+		}
+		else
+		{
+			const int32 OldIndex = Previous->GetConceptIndex(ConceptPaths[Index]);
+			Catalog->ConceptTiers[Index] = Previous->ConceptTiers[OldIndex];
+			for (const uint32 OldLink : Previous->GetRelatedConcepts(OldIndex))
+			{
+				if (ConceptRemap[OldLink] != INDEX_NONE)
+				{
+					Catalog->RelatedStorage.Add(ConceptRemap[OldLink]);
+				}
+			}
+		}
+	}
+	Catalog->RelatedStartStorage.Add(Catalog->RelatedStorage.Num());
+
+	// Skill types and requirement masks, the same way
+	Catalog->MaskWords = FMath::DivideAndRoundUp(ConceptPaths.Num(), 64);
+	Catalog->SkillTypes.SetNumZeroed(SkillPaths.Num());
+	Catalog->RequirementMaskStorage.SetNumZeroed(SkillPaths.Num() * Catalog->MaskWords);
+	for (int32 Index = 0; Index < SkillPaths.Num(); ++Index)
+	{
+		uint64* Mask = Catalog->RequirementMaskStorage.GetData() + Index * Catalog->MaskWords;
+
+		if (const FConceptCatalogAssetRecord* const* Record = ChangedSkills.Find(SkillPaths[Index]))
+		{
+			Catalog->SkillTypes[Index] = (*Record)->Bucket;
+			for (const FSoftObjectPath& Link : (*Record)->Links)
+			{
+				const int32 LinkIndex = ResolveLink(Link);
+				if (LinkIndex != INDEX_NONE)
+				{
+					Mask[LinkIndex / 64] |= uint64(1) << (LinkIndex % 64);
+				}
+			}
+		}
+		else
+		{
+			const int32 OldIndex = Previous->GetSkillIndex(SkillPaths[Index]);
+			Catalog->SkillTypes[Index] = Previous->SkillTypes[OldIndex];
+
+			const TConstArrayView<uint64> OldMask = Previous->GetRequirementMask(OldIndex);
+			if (!bConceptIndicesMoved)
+			{
+				FMemory::Memcpy(Mask, OldMask.GetData(), Catalog->MaskWords * sizeof(uint64));
+				continue;
+			}
+
+			for (int32 Word = 0; Word < OldMask.Num(); ++Word)
+			{
+				for (uint64 Bits = OldMask[Word]; Bits != 0; Bits &= Bits - 1)
+				{
+					const int32 NewIndex = ConceptRemap[Word * 64 + FMath::CountTrailingZeros64(Bits)];
+					if (NewIndex != INDEX_NONE)
+					{
+						Mask[NewIndex / 64] |= uint64(1) << (NewIndex % 64);
+					}
+				}
+			}
+		}
+	}
+
+	// Every tier and type has an entry, even if empty
+	Catalog->ConceptsByTier.Add(EConceptTier::Physical);
+	Catalog->ConceptsByTier.Add(EConceptTier::Intermediate);
+	Catalog->ConceptsByTier.Add(EConceptTier::Advanced);
+	Catalog->ConceptsByTier.Add(EConceptTier::Abstract);
+
+	Catalog->SkillsByType.Add(ESkillManifestationType::Active);
+	Catalog->SkillsByType.Add(ESkillManifestationType::Passive);
+	Catalog->SkillsByType.Add(ESkillManifestationType::Crafting);
+	Catalog->SkillsByType.Add(ESkillManifestationType::Proficiency);
+
+	for (int32 Index = 0; Index < ConceptPaths.Num(); ++Index)
+	{
+		Catalog->ConceptsByTier.FindOrAdd(static_cast<EConceptTier>(Catalog->ConceptTiers[Index])).Add(Catalog->Concepts[Index]);
+	}
+
+	for (int32 Index = 0; Index < SkillPaths.Num(); ++Index)
+	{
+		Catalog->SkillsByType.FindOrAdd(static_cast<ESkillManifestationType>(Catalog->SkillTypes[Index])).Add(Catalog->Skills[Index]);
+	}
+
+	Catalog->RequirementMasks = Catalog->RequirementMaskStorage;
+	Catalog->RelatedStarts = Catalog->RelatedStartStorage;
+	Catalog->Related = Catalog->RelatedStorage;
+
+	// Reachability crosses every link, so it is always recomputed rather than patched
+	Catalog->BuildReachability();
+	return Catalog;
+}
+
+void FConceptCatalog::BuildReachability()
+{
+	const int32 NumTiers = StaticEnum<EConceptTier>()->NumEnums() - 1;
+	FConceptGraph::BuildReachability(RelatedStarts, Related, ConceptTiers, NumTiers, MaskWords, ConceptComponents, CyclicComponents, TierReachMasks);
+}
+
+void FConceptCatalog::LoadCatalogAssets(const TArray<FSoftObjectPath>& Paths, const TArray<FPrimaryAssetId>& AssetIds)
+{
+	UAssetManager& AssetManager = UAssetManager::Get();
+
+	TArray<FPrimaryAssetId> PrimaryAssetIds;
+	for (int32 Index = 0; Index < Paths.Num(); ++Index)
+	{
+		const FPrimaryAssetId& AssetId = AssetIds[Index];
+		if (AssetId.IsValid() && AssetManager.GetPrimaryAssetPath(AssetId).IsValid())
+		{
+			PrimaryAssetIds.Add(AssetId);
+		}
+		else
+		{
+			// Not registered as a primary asset type: loads the asset itself, but no bundle
+			Paths[Index].TryLoad();
+		}
+	}
+
+	// The catalog is needed before anything else runs, so wait for it
+	if (PrimaryAssetIds.Num() > 0)
+	{
+		TSharedPtr<FStreamableHandle> Handle = AssetManager.LoadPrimaryAssets(PrimaryAssetIds, { ConceptAssetBundles::Gameplay });
+		if (Handle.IsValid())
+		{
+			Handle->WaitUntilComplete();
+		}
+	}
+}
+
+bool FConceptCatalog::CaptureRecord(const FSoftObjectPath& Path, FConceptCatalogDelta& OutDelta)
+{
+	UObject* Object = Path.ResolveObject();
+
+	if (const UConcept* Concept = Cast<UConcept>(Object))
+	{
+		FConceptCatalogAssetRecord& Record = OutDelta.Concepts.AddDefaulted_GetRef();
+		Record.Path = Path;
+		Record.Bucket = static_cast<uint8>(Concept->Tier);
+		for (const TSoftObjectPtr<UConcept>& RelatedConcept : Concept->RelatedConcepts)
+		{
+			Record.Links.Add(RelatedConcept.ToSoftObjectPath());
+		}
+		return true;
+	}
+
+	if (const UConceptSkill* Skill = Cast<UConceptSkill>(Object))
+	{
+		FConceptCatalogAssetRecord& Record = OutDelta.Skills.AddDefaulted_GetRef();
+		Record.Path = Path;
+		Record.Bucket = static_cast<uint8>(Skill->ManifestationType);
+		for (const TSoftObjectPtr<UConcept>& RequiredConcept : Skill->RequiredConcepts)
+		{
+			Record.Links.Add(RequiredConcept.ToSoftObjectPath());
+		}
+		return true;
+	}
+
+	return false;
+}
+
+#if WITH_EDITOR
+namespace ConceptCatalogPublishing
+{
+	static bool IsCatalogAsset(const FAssetData& AssetData)
+	{
+		const UClass* Class = AssetData.GetClass();
+		return Class && (Class->IsChildOf(UConcept::StaticClass()) || Class->IsChildOf(UConceptSkill::StaticClass()));
+	}
+}
+
+void FConceptCatalog::StartWatchingAssets()
+{
+	using namespace ConceptCatalogPublishing;
+
+	// Edits and reimports both end in a property change notification on the asset
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject* Object, FPropertyChangedEvent& Event)
+	{
+		if ((Object->IsA<UConcept>() || Object->IsA<UConceptSkill>()) && Object->IsAsset())
+		{
+			QueueRefresh({ FSoftObjectPath(Object) }, {});
+		}
+	});
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddLambda([](const FAssetData& AssetData)
+	{
+		// The initial scan reports every asset as added; the first build already covers those
+		if (IsCatalogAsset(AssetData) && !IAssetRegistry::GetChecked().IsLoadingAssets())
+		{
+			QueueRefresh({ AssetData.ToSoftObjectPath() }, {});
+		}
+	});
+
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda([](const FAssetData& AssetData)
+	{
+		if (IsCatalogAsset(AssetData))
+		{
+			QueueRefresh({}, { AssetData.ToSoftObjectPath() });
+		}
+	});
+
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda([](const FAssetData& AssetData, const FString& OldObjectPath)
+	{
+		if (IsCatalogAsset(AssetData))
+		{
+			QueueRefresh({ AssetData.ToSoftObjectPath() }, { FSoftObjectPath(OldObjectPath) });
+		}
+	});
+}
+
+void FConceptCatalog::StopWatchingAssets()
+{
+	using namespace ConceptCatalogPublishing;
+
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	PropertyChangedHandle.Reset();
+
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+	AssetAddedHandle.Reset();
+	AssetRemovedHandle.Reset();
+	AssetRenamedHandle.Reset();
+}
+#endif
@@ -0,0 +1,98 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptCatalogCommandlet.h"
+#include "ConceptCatalog.h"
+#include "ConceptCatalogFile.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/AssetRegistryState.h"
+#include "Serialization/ArrayReader.h"
+#include "Misc/FileHelper.h"
+
+UConceptCatalogCommandlet::UConceptCatalogCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UConceptCatalogCommandlet::Main(const FString& Params)
+{
+	FString OutputPath = FConceptCatalogFile::GetDefaultPath();
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FString CookedRegistryPath;
+	if (FParse::Value(*Params, TEXT("VerifyCooked="), CookedRegistryPath))
+	{
+		return VerifyCooked(OutputPath, CookedRegistryPath);
+	}
+
+	// Commandlets start before the asset registry has finished its scan
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> Catalog = FConceptCatalog::BuildFromAssetRegistry();
+
+	TArray<uint8> Data;
+	FConceptCatalogFile::Write(*Catalog, Data);
+
+	if (!FFileHelper::SaveArrayToFile(Data, *OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ConceptCatalogCommandlet: Failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("ConceptCatalogCommandlet: Wrote %d concepts, %d skills, %d related links to %s (%d bytes, hash %08x)"),
+		Catalog->Concepts.Num(), Catalog->Skills.Num(), Catalog->Related.Num(), *OutputPath, Data.Num(), Catalog->Hash);
+	return 0;
+}
+
+int32 UConceptCatalogCommandlet::VerifyCooked(const FString& CatalogPath, const FString& RegistryPath) const
+{
+	TSharedPtr<FConceptCatalogFile, ESPMode::ThreadSafe> CatalogFile = FConceptCatalogFile::Map(CatalogPath);
+	if (!CatalogFile)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ConceptCatalogCommandlet: No valid catalog at %s to verify"), *CatalogPath);
+		return 1;
+	}
+
+	FArrayReader RegistryData;
+	FAssetRegistryState CookedState;
+	if (!FFileHelper::LoadFileToArray(RegistryData, *RegistryPath) || !CookedState.Load(RegistryData))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ConceptCatalogCommandlet: Could not load the cooked asset registry %s"), *RegistryPath);
+		return 1;
+	}
+
+	// The same filter the runtime scan uses; the editor's registry expands it to every subclass
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassNames.Add(UConcept::StaticClass()->GetFName());
+	Filter.ClassNames.Add(UConceptSkill::StaticClass()->GetFName());
+	Filter.bRecursiveClasses = true;
+
+	FARCompiledFilter CompiledFilter;
+	AssetRegistry.CompileFilter(Filter, CompiledFilter);
+
+	TArray<FAssetData> CookedAssets;
+	CookedState.GetAssets(CompiledFilter, TSet<FName>(), CookedAssets);
+
+	TArray<FSoftObjectPath> CookedPaths;
+	CookedPaths.Reserve(CookedAssets.Num());
+	for (const FAssetData& Asset : CookedAssets)
+	{
+		CookedPaths.Add(Asset.ToSoftObjectPath());
+	}
+
+	if (!CatalogFile->MatchesAssets(CookedPaths))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ConceptCatalogCommandlet: %s lists %u concepts and %u skills, but the cook has %d concept and skill assets; rerun the catalog step against the cooked content"),
+			*CatalogPath, CatalogFile->GetHeader().NumConcepts, CatalogFile->GetHeader().NumSkills, CookedPaths.Num());
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("ConceptCatalogCommandlet: %s matches the %d concept and skill assets in %s"), *CatalogPath, CookedPaths.Num(), *RegistryPath);
+	return 0;
+}
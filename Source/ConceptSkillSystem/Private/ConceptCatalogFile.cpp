@@ -0,0 +1,358 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptCatalogFile.h"
+#include "ConceptCatalog.h"
+#include "Algo/AllOf.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/NoneOf.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+
+namespace ConceptCatalogFile
+{
+	static const uint32 Magic = 0x4B545343; // 'CSTK'
+	static const uint32 Version = 2;
+
+	// Reads back as 0x04030201 on a machine of the other byte order
+	static const uint32 ByteOrderMark = 0x01020304;
+
+	// Reserve an 8-byte aligned section and return its offset
+	static uint32 AddSection(TArray<uint8>& Data, int64 Bytes)
+	{
+		const int32 Offset = Align(Data.Num(), 8);
+		Data.SetNumZeroed(Offset + static_cast<int32>(Bytes));
+		return Offset;
+	}
+
+	template<typename T>
+	static uint32 WriteSection(TArray<uint8>& Data, TConstArrayView<T> Items)
+	{
+		const uint32 Offset = AddSection(Data, Items.Num() * sizeof(T));
+		if (Items.Num() > 0)
+		{
+			FMemory::Memcpy(Data.GetData() + Offset, Items.GetData(), Items.Num() * sizeof(T));
+		}
+		return Offset;
+	}
+
+	// Name table sorted by hash, for binary search
+	static TArray<FConceptCatalogFileName> MakeNameTable(TConstArrayView<FConceptCatalogFileEntry> Entries)
+	{
+		TArray<FConceptCatalogFileName> Names;
+		Names.Reserve(Entries.Num());
+		for (int32 Index = 0; Index < Entries.Num(); ++Index)
+		{
+			Names.Add({ Entries[Index].NameHash, static_cast<uint32>(Index) });
+		}
+
+		Names.Sort([](const FConceptCatalogFileName& A, const FConceptCatalogFileName& B)
+		{
+			return A.NameHash != B.NameHash ? A.NameHash < B.NameHash : A.Index < B.Index;
+		});
+		return Names;
+	}
+}
+
+FConceptCatalogFile::~FConceptCatalogFile()
+{
+	// The region must be unmapped before its file handle closes
+	Region.Reset();
+	Handle.Reset();
+}
+
+FString FConceptCatalogFile::GetDefaultPath()
+{
+	return FPaths::ProjectContentDir() / TEXT("ConceptCatalog") / TEXT("ConceptCatalog.bin");
+}
+
+uint32 FConceptCatalogFile::HashName(const FString& AssetName)
+{
+	return FCrc::StrCrc32(*AssetName.ToLower());
+}
+
+TSharedPtr<FConceptCatalogFile, ESPMode::ThreadSafe> FConceptCatalogFile::Map(const FString& Filename)
+{
+	TSharedPtr<FConceptCatalogFile, ESPMode::ThreadSafe> File = MakeShareable(new FConceptCatalogFile());
+
+	File->Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (!File->Handle.IsValid())
+	{
+		return nullptr;
+	}
+
+	File->Region.Reset(File->Handle->MapRegion());
+	if (!File->Region.IsValid())
+	{
+		return nullptr;
+	}
+
+	File->Data = File->Region->GetMappedPtr();
+	File->Size = File->Region->GetMappedSize();
+
+	if (!File->Validate())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ConceptCatalogFile: %s is not a valid version %u catalog"), *Filename, ConceptCatalogFile::Version);
+		return nullptr;
+	}
+
+	return File;
+}
+
+bool FConceptCatalogFile::Validate() const
+{
+	if (Size < static_cast<int64>(sizeof(FConceptCatalogFileHeader)))
+	{
+		return false;
+	}
+
+	const FConceptCatalogFileHeader& Header = GetHeader();
+	if (Header.Magic != ConceptCatalogFile::Magic && Header.Magic == BYTESWAP_ORDER32(ConceptCatalogFile::Magic))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ConceptCatalogFile: Catalog was cooked on a machine of the other byte order; recook it for this platform"));
+		return false;
+	}
+
+	if (Header.Magic != ConceptCatalogFile::Magic || Header.Version != ConceptCatalogFile::Version
+		|| Header.ByteOrderMark != ConceptCatalogFile::ByteOrderMark || Header.FileSize != Size)
+	{
+		return false;
+	}
+
+	// The buckets are indexed by enum value, so they must match the enums this build was compiled with
+	if (Header.NumTiers != static_cast<uint32>(StaticEnum<EConceptTier>()->NumEnums() - 1)
+		|| Header.NumTypes != static_cast<uint32>(StaticEnum<ESkillManifestationType>()->NumEnums() - 1)
+		|| Header.MaskWords != static_cast<uint32>(FMath::DivideAndRoundUp(Header.NumConcepts, 64u)))
+	{
+		return false;
+	}
+
+	// Checked once here so every accessor can read in place
+	auto InBounds = [this](uint32 Offset, uint64 Num, uint64 ElementSize)
+	{
+		return (Offset % 4) == 0 && static_cast<uint64>(Offset) + Num * ElementSize <= static_cast<uint64>(Size);
+	};
+
+	const bool bSectionsInBounds = InBounds(Header.ConceptsOffset, Header.NumConcepts, sizeof(FConceptCatalogFileEntry))
+		&& InBounds(Header.SkillsOffset, Header.NumSkills, sizeof(FConceptCatalogFileEntry))
+		&& InBounds(Header.TierStartsOffset, Header.NumTiers + 1, sizeof(uint32))
+		&& InBounds(Header.TierConceptsOffset, Header.NumConcepts, sizeof(uint32))
+		&& InBounds(Header.TypeStartsOffset, Header.NumTypes + 1, sizeof(uint32))
+		&& InBounds(Header.TypeSkillsOffset, Header.NumSkills, sizeof(uint32))
+		&& (Header.RequirementMasksOffset % 8) == 0
+		&& InBounds(Header.RequirementMasksOffset, static_cast<uint64>(Header.NumSkills) * Header.MaskWords, sizeof(uint64))
+		&& InBounds(Header.RelatedStartsOffset, Header.NumConcepts + 1, sizeof(uint32))
+		&& InBounds(Header.RelatedOffset, Header.NumRelated, sizeof(uint32))
+		&& InBounds(Header.ConceptNamesOffset, Header.NumConcepts, sizeof(FConceptCatalogFileName))
+		&& InBounds(Header.SkillNamesOffset, Header.NumSkills, sizeof(FConceptCatalogFileName))
+		&& static_cast<uint64>(Header.StringsOffset) + Header.StringsSize <= static_cast<uint64>(Size);
+	if (!bSectionsInBounds)
+	{
+		return false;
+	}
+
+	// Offset tables start at 0, never decrease and end at the size of the array they index
+	auto IsOffsetTable = [](TConstArrayView<uint32> Starts, uint32 Count)
+	{
+		if (Starts[0] != 0 || Starts.Last() != Count)
+		{
+			return false;
+		}
+		for (int32 Index = 1; Index < Starts.Num(); ++Index)
+		{
+			if (Starts[Index] < Starts[Index - 1])
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	auto AllBelow = [](TConstArrayView<uint32> Ids, uint32 Count)
+	{
+		return Algo::NoneOf(Ids, [Count](uint32 Id) { return Id >= Count; });
+	};
+
+	auto AreEntriesValid = [&Header](TConstArrayView<FConceptCatalogFileEntry> Entries, uint32 NumBuckets)
+	{
+		return Algo::NoneOf(Entries, [&Header, NumBuckets](const FConceptCatalogFileEntry& Entry)
+		{
+			return Entry.Bucket >= NumBuckets || static_cast<uint64>(Entry.PathOffset) + Entry.PathLength > Header.StringsSize;
+		});
+	};
+
+	auto IsNameTableValid = [](TConstArrayView<FConceptCatalogFileName> Names, uint32 Count)
+	{
+		return Algo::NoneOf(Names, [Count](const FConceptCatalogFileName& Name) { return Name.Index >= Count; });
+	};
+
+	return IsOffsetTable(GetTierStarts(), Header.NumConcepts)
+		&& IsOffsetTable(GetTypeStarts(), Header.NumSkills)
+		&& IsOffsetTable(GetRelatedStarts(), Header.NumRelated)
+		&& AllBelow(GetTierConcepts(), Header.NumConcepts)
+		&& AllBelow(GetTypeSkills(), Header.NumSkills)
+		&& AllBelow(GetRelated(), Header.NumConcepts)
+		&& AreEntriesValid(GetConcepts(), Header.NumTiers)
+		&& AreEntriesValid(GetSkills(), Header.NumTypes)
+		&& IsNameTableValid(Section<FConceptCatalogFileName>(Header.ConceptNamesOffset, Header.NumConcepts), Header.NumConcepts)
+		&& IsNameTableValid(Section<FConceptCatalogFileName>(Header.SkillNamesOffset, Header.NumSkills), Header.NumSkills);
+}
+
+bool FConceptCatalogFile::MatchesAssets(TConstArrayView<FSoftObjectPath> AssetPaths) const
+{
+	const FConceptCatalogFileHeader& Header = GetHeader();
+	if (static_cast<uint64>(AssetPaths.Num()) != static_cast<uint64>(Header.NumConcepts) + Header.NumSkills)
+	{
+		return false;
+	}
+
+	// Paths are unique, so with equal counts every asset being found means the sets are equal
+	return Algo::AllOf(AssetPaths, [this](const FSoftObjectPath& Path)
+	{
+		return FindConcept(Path) != INDEX_NONE || FindSkill(Path) != INDEX_NONE;
+	});
+}
+
+FSoftObjectPath FConceptCatalogFile::GetPath(const FConceptCatalogFileEntry& Entry) const
+{
+	const FConceptCatalogFileHeader& Header = GetHeader();
+	if (static_cast<uint64>(Entry.PathOffset) + Entry.PathLength > Header.StringsSize)
+	{
+		return FSoftObjectPath();
+	}
+
+	const ANSICHAR* Path = reinterpret_cast<const ANSICHAR*>(Data + Header.StringsOffset + Entry.PathOffset);
+	const FUTF8ToTCHAR Converted(Path, Entry.PathLength);
+	return FSoftObjectPath(FString(Converted.Length(), Converted.Get()));
+}
+
+int32 FConceptCatalogFile::FindConcept(const FSoftObjectPath& Path) const
+{
+	return Find(Section<FConceptCatalogFileName>(GetHeader().ConceptNamesOffset, GetHeader().NumConcepts), GetConcepts(), Path);
+}
+
+int32 FConceptCatalogFile::FindSkill(const FSoftObjectPath& Path) const
+{
+	return Find(Section<FConceptCatalogFileName>(GetHeader().SkillNamesOffset, GetHeader().NumSkills), GetSkills(), Path);
+}
+
+int32 FConceptCatalogFile::Find(TConstArrayView<FConceptCatalogFileName> Names, TConstArrayView<FConceptCatalogFileEntry> Entries, const FSoftObjectPath& Path) const
+{
+	if (Path.IsNull())
+	{
+		return INDEX_NONE;
+	}
+
+	const uint32 NameHash = HashName(Path.GetAssetName());
+	int32 Index = Algo::LowerBoundBy(Names, NameHash, &FConceptCatalogFileName::NameHash);
+
+	// Asset names are unique within a catalog in practice, so this usually checks a single path
+	for (; Index < Names.Num() && Names[Index].NameHash == NameHash; ++Index)
+	{
+		const uint32 EntryIndex = Names[Index].Index;
+		if (Entries.IsValidIndex(EntryIndex) && GetPath(Entries[EntryIndex]) == Path)
+		{
+			return EntryIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void FConceptCatalogFile::Write(const FConceptCatalog& Catalog, TArray<uint8>& OutData)
+{
+	using namespace ConceptCatalogFile;
+
+	const int32 NumTiers = StaticEnum<EConceptTier>()->NumEnums() - 1;
+	const int32 NumTypes = StaticEnum<ESkillManifestationType>()->NumEnums() - 1;
+
+	TArray<uint8> Strings;
+	auto AddString = [&Strings](const FString& String, FConceptCatalogFileEntry& Entry)
+	{
+		const FTCHARToUTF8 Utf8(*String);
+		Entry.PathOffset = Strings.Num();
+		Entry.PathLength = Utf8.Length();
+		Strings.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		Strings.Add(0);
+	};
+
+	// Entries and buckets; a concept or skill that failed to load lands in the first bucket, as a scan would skip it
+	TArray<FConceptCatalogFileEntry> ConceptEntries;
+	TArray<TArray<uint32>> TierBuckets;
+	TierBuckets.SetNum(NumTiers);
+	for (int32 Index = 0; Index < Catalog.Concepts.Num(); ++Index)
+	{
+		const FSoftObjectPath Path = Catalog.Concepts[Index].ToSoftObjectPath();
+		const UConcept* Concept = Catalog.Concepts[Index].Get();
+
+		FConceptCatalogFileEntry& Entry = ConceptEntries.AddZeroed_GetRef();
+		AddString(Path.ToString(), Entry);
+		Entry.NameHash = HashName(Path.GetAssetName());
+		Entry.Bucket = Concept ? static_cast<uint32>(Concept->Tier) : 0;
+		TierBuckets[Entry.Bucket].Add(Index);
+	}
+
+	TArray<FConceptCatalogFileEntry> SkillEntries;
+	TArray<TArray<uint32>> TypeBuckets;
+	TypeBuckets.SetNum(NumTypes);
+	for (int32 Index = 0; Index < Catalog.Skills.Num(); ++Index)
+	{
+		const FSoftObjectPath Path = Catalog.Skills[Index].ToSoftObjectPath();
+		const UConceptSkill* Skill = Catalog.Skills[Index].Get();
+
+		FConceptCatalogFileEntry& Entry = SkillEntries.AddZeroed_GetRef();
+		AddString(Path.ToString(), Entry);
+		Entry.NameHash = HashName(Path.GetAssetName());
+		Entry.Bucket = Skill ? static_cast<uint32>(Skill->ManifestationType) : 0;
+		TypeBuckets[Entry.Bucket].Add(Index);
+	}
+
+	// Flatten buckets into start offsets plus one ID array
+	auto Flatten = [](const TArray<TArray<uint32>>& Buckets, TArray<uint32>& OutStarts, TArray<uint32>& OutIds)
+	{
+		for (const TArray<uint32>& Bucket : Buckets)
+		{
+			OutStarts.Add(OutIds.Num());
+			OutIds.Append(Bucket);
+		}
+		OutStarts.Add(OutIds.Num());
+	};
+
+	TArray<uint32> TierStarts, TierConcepts, TypeStarts, TypeSkills;
+	Flatten(TierBuckets, TierStarts, TierConcepts);
+	Flatten(TypeBuckets, TypeStarts, TypeSkills);
+
+	OutData.Reset();
+	const uint32 HeaderOffset = AddSection(OutData, sizeof(FConceptCatalogFileHeader));
+	check(HeaderOffset == 0);
+
+	FConceptCatalogFileHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.ByteOrderMark = ByteOrderMark;
+	Header.CatalogHash = Catalog.Hash;
+	Header.NumConcepts = Catalog.Concepts.Num();
+	Header.NumSkills = Catalog.Skills.Num();
+	Header.NumTiers = NumTiers;
+	Header.NumTypes = NumTypes;
+	Header.MaskWords = Catalog.MaskWords;
+	Header.NumRelated = Catalog.Related.Num();
+
+	Header.ConceptsOffset = WriteSection<FConceptCatalogFileEntry>(OutData, ConceptEntries);
+	Header.SkillsOffset = WriteSection<FConceptCatalogFileEntry>(OutData, SkillEntries);
+	Header.TierStartsOffset = WriteSection<uint32>(OutData, TierStarts);
+	Header.TierConceptsOffset = WriteSection<uint32>(OutData, TierConcepts);
+	Header.TypeStartsOffset = WriteSection<uint32>(OutData, TypeStarts);
+	Header.TypeSkillsOffset = WriteSection<uint32>(OutData, TypeSkills);
+	Header.RequirementMasksOffset = WriteSection<uint64>(OutData, Catalog.RequirementMasks);
+	Header.RelatedStartsOffset = WriteSection<uint32>(OutData, Catalog.RelatedStarts);
+	Header.RelatedOffset = WriteSection<uint32>(OutData, Catalog.Related);
+	Header.ConceptNamesOffset = WriteSection<FConceptCatalogFileName>(OutData, MakeNameTable(ConceptEntries));
+	Header.SkillNamesOffset = WriteSection<FConceptCatalogFileName>(OutData, MakeNameTable(SkillEntries));
+	Header.StringsOffset = WriteSection<uint8>(OutData, Strings);
+	Header.StringsSize = Strings.Num();
+	Header.FileSize = OutData.Num();
+
+	FMemory::Memcpy(OutData.GetData(), &Header, sizeof(Header));
+}
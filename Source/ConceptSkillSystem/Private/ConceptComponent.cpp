@@ -3,10 +3,175 @@
 #include "ConceptComponent.h"
 #include "Abilities/ConceptAbilitySystemComponent.h"
 #include "ConceptSkillTags.h"
+#include "ConceptRegistry.h"
+#include "ConceptSaveArchive.h"
+#include "ConceptJournal.h"
+#include "ConceptStateSnapshot.h"
+#include "ConceptObservationSubsystem.h"
+#include "ConceptSystemSubsystem.h"
+#include "ConceptualObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Net/UnrealNetwork.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/UObjectIterator.h"
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ConceptSaveBenchmarkCommand(
+	TEXT("ConceptSkill.SaveBenchmark"),
+	TEXT("Compare the binary concept state format with tagged-property serialization of the same component: ConceptSkill.SaveBenchmark [Iterations=1000]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+
+		UConceptComponent* Source = nullptr;
+		for (TObjectIterator<UConceptComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->GetOwner() && It->GetOwner()->HasAuthority())
+			{
+				Source = *It;
+				break;
+			}
+		}
+
+		if (!Source)
+		{
+			Ar.Logf(TEXT("SaveBenchmark: No concept component with authority in this world."));
+			return;
+		}
+
+		// Loads go into a detached copy so the source keeps its tags and replication state
+		UConceptComponent* Scratch = NewObject<UConceptComponent>(Source->GetOwner(), NAME_None, RF_Transient);
+
+		TArray<uint8> Binary;
+		double BinarySave = 0.0;
+		double BinaryLoad = 0.0;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const double Start = FPlatformTime::Seconds();
+			if (!Source->SaveConceptState(Binary))
+			{
+				Ar.Logf(TEXT("SaveBenchmark: SaveConceptState failed."));
+				return;
+			}
+			const double Saved = FPlatformTime::Seconds();
+			Scratch->LoadConceptState(Binary);
+			BinaryLoad += FPlatformTime::Seconds() - Saved;
+			BinarySave += Saved - Start;
+		}
+
+		TArray<uint8> Tagged;
+		double TaggedSave = 0.0;
+		double TaggedLoad = 0.0;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Tagged.Reset();
+			FMemoryWriter MemoryWriter(Tagged, true);
+			FObjectAndNameAsStringProxyArchive Writer(MemoryWriter, false);
+			Source->Serialize(Writer);
+			const double Saved = FPlatformTime::Seconds();
+
+			FMemoryReader MemoryReader(Tagged, true);
+			FObjectAndNameAsStringProxyArchive Reader(MemoryReader, true);
+			Scratch->Serialize(Reader);
+			TaggedLoad += FPlatformTime::Seconds() - Saved;
+			TaggedSave += Saved - Start;
+		}
+
+		Scratch->MarkAsGarbage();
+
+		Ar.Logf(TEXT("SaveBenchmark: %s, %d iterations"), *GetNameSafe(Source->GetOwner()), Iterations);
+		Ar.Logf(TEXT("  Binary:          %6d bytes, save %.2f us, load %.2f us"), Binary.Num(), BinarySave * 1e6 / Iterations, BinaryLoad * 1e6 / Iterations);
+		Ar.Logf(TEXT("  Tagged property: %6d bytes, save %.2f us, load %.2f us"), Tagged.Num(), TaggedSave * 1e6 / Iterations, TaggedLoad * 1e6 / Iterations);
+	}));
+
+// Serializes slot deltas the way the fast array sends them: a delta header, then the replication ID and every
+// replicated property of each changed item. No connection is involved, so these are payload bits before packet overhead.
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ConceptSlotRepBenchmarkCommand(
+	TEXT("ConceptSkill.SlotRepBenchmark"),
+	TEXT("Measure the bytes a slot delta costs against resending every slot: ConceptSkill.SlotRepBenchmark"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		UConceptComponent* Source = nullptr;
+		for (TObjectIterator<UConceptComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->GetOwner() && It->GetOwner()->HasAuthority() && It->Slots.Items.Num() > 0)
+			{
+				Source = *It;
+				break;
+			}
+		}
+
+		if (!Source)
+		{
+			Ar.Logf(TEXT("SlotRepBenchmark: No concept component with slots and authority in this world."));
+			return;
+		}
+
+		// FastArrayDeltaSerialize header: array and base replication keys, then the delete and change counts
+		auto WriteHeader = [](FBitWriter& Writer, int32 NumChanged)
+		{
+			int32 ArrayReplicationKey = 1;
+			int32 BaseReplicationKey = 0;
+			int32 NumDeletes = 0;
+			Writer << ArrayReplicationKey << BaseReplicationKey << NumDeletes << NumChanged;
+		};
+
+		auto WriteItem = [](FBitWriter& Writer, FConceptSlot& Slot)
+		{
+			int32 ReplicationID = Slot.ReplicationID;
+			Writer << ReplicationID;
+			for (TFieldIterator<FProperty> It(FConceptSlot::StaticStruct()); It; ++It)
+			{
+				if (!It->HasAnyPropertyFlags(CPF_RepSkip))
+				{
+					It->NetSerializeItem(Writer, nullptr, It->ContainerPtrToValuePtr<void>(&Slot));
+				}
+			}
+		};
+
+		// Copies, so the benchmark never touches the replicated state
+		TArray<FConceptSlot> Slots = Source->Slots.Items;
+
+		FBitWriter Delta(0, true);
+		WriteHeader(Delta, 1);
+		WriteItem(Delta, Slots[0]);
+
+		FBitWriter Full(0, true);
+		WriteHeader(Full, Slots.Num());
+		for (FConceptSlot& Slot : Slots)
+		{
+			WriteItem(Full, Slot);
+		}
+
+		Ar.Logf(TEXT("SlotRepBenchmark: %s, %d slots"), *GetNameSafe(Source->GetOwner()), Slots.Num());
+		Ar.Logf(TEXT("  One changed slot: %6lld bytes"), (Delta.GetNumBits() + 7) / 8);
+		Ar.Logf(TEXT("  Every slot:       %6lld bytes"), (Full.GetNumBits() + 7) / 8);
+	}));
 
 UConceptComponent::UConceptComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Per-frame work is batched by UConceptSystemSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// Slot state is authoritative on the server and delta-replicated to clients
+	SetIsReplicatedByDefault(true);
+
+	// The public summary is rebuilt on its own, slower cadence
+	SummaryUpdateInterval = 0.5f;
+	MaxPublicSynergies = 3;
+	bPublicSummaryDirty = false;
+
+	// Journaling is off until a journal is attached
+	JournalCompactionThreshold = 256;
+	NextJournalSequence = 1;
+	RecordsSinceCompaction = 0;
+	bReplayingJournal = false;
+
+	// Preview snapshots use negative keys so they never collide with prediction keys
+	NextPreviewKey = -1;
+	PreviewDepth = 0;
 
 	// Initialize default max slots per body part
 	MaxSlotsPerBodyPart.Add(EBodyPartType::Head, 3);
@@ -17,6 +182,17 @@ UConceptComponent::UConceptComponent()
 	// Set default grid dimensions for inventory system based on user suggestion
 	GridWidth = 5;  // Default grid width
 	GridHeight = 10;  // Default grid height, can be adjusted in editor or based on max slots
+
+	Grammar = nullptr;
+}
+
+void UConceptComponent::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Set here rather than in the constructor, where initializing from the archetype copies the containers over
+	Slots.Owner = this;
+	Knowledge.Owner = this;
 }
 
 void UConceptComponent::BeginPlay()
@@ -24,6 +200,18 @@ void UConceptComponent::BeginPlay()
 	Super::BeginPlay();
 	InitializeSlots();
 	UE_LOG(LogTemp, Log, TEXT("ConceptComponent initialized for actor %s"), *GetOwner()->GetName());
+
+	// Only the server publishes the summary for other clients
+	MarkPublicSummaryDirty();
+
+	// Observation is resolved on the server
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		if (UConceptObservationSubsystem* Observation = UConceptObservationSubsystem::Get(this))
+		{
+			Observation->RegisterObserver(this);
+		}
+	}
 	
 	// Find or create the ability system component
 	AActor* Owner = GetOwner();
@@ -39,9 +227,34 @@ void UConceptComponent::BeginPlay()
 	}
 }
 
-void UConceptComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UConceptComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UConceptObservationSubsystem* Observation = UConceptObservationSubsystem::Get(this))
+	{
+		Observation->UnregisterObserver(this);
+	}
+
+	// Make sure every journaled mutation reaches disk
+	if (Journal.IsValid())
+	{
+		Journal->Flush();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UConceptComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// Full detail only goes to the owning client
+	DOREPLIFETIME_CONDITION(UConceptComponent, Slots, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(UConceptComponent, Knowledge, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(UConceptComponent, MediatedSkills, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(UConceptComponent, ProgressionPool, COND_OwnerOnly);
+
+	// Everyone else only sees the coarse summary
+	DOREPLIFETIME_CONDITION(UConceptComponent, PublicSummary, COND_SkipOwner);
 }
 
 UAbilitySystemComponent* UConceptComponent::GetAbilitySystemComponent() const
@@ -51,52 +264,22 @@ UAbilitySystemComponent* UConceptComponent::GetAbilitySystemComponent() const
 
 void UConceptComponent::InitializeSlots()
 {
+	// Clients receive their slots through replication
+	if (GetOwner() && !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	Slots.Reset();
+	GrammarGrids.Reset();
+
 	// Create initial slots for each body part based on MaxSlotsPerBodyPart
 	for (const auto& Pair : MaxSlotsPerBodyPart)
 	{
-		EBodyPartType BodyPart = Pair.Key;
-		int32 MaxSlots = Pair.Value;
-		
-		TArray<FConceptSlot> Slots;
-		for (int32 i = 0; i < MaxSlots; ++i)
-		{
-			FConceptSlot NewSlot;
-			NewSlot.BodyPart = BodyPart;
-			
-			// Only unlock the first slot for each body part by default
-			NewSlot.bIsUnlocked = (i == 0);
-			
-			// Set max tier based on body part
-			switch (BodyPart)
-			{
-			case EBodyPartType::Head:
-				NewSlot.MaxTier = EConceptTier::Abstract; // Head can hold the highest tier concepts
-				break;
-			case EBodyPartType::Body:
-				NewSlot.MaxTier = EConceptTier::Advanced;
-				break;
-			case EBodyPartType::Arms:
-				NewSlot.MaxTier = EConceptTier::Intermediate;
-				break;
-			case EBodyPartType::Feet:
-				NewSlot.MaxTier = EConceptTier::Physical;
-				break;
-			default:
-				NewSlot.MaxTier = EConceptTier::Physical;
-				break;
-			}
-			
-			// Assign grid coordinates based on index and GridWidth for inventory system
-			NewSlot.XCoordinate = i % GridWidth;
-			NewSlot.YCoordinate = i / GridWidth;
-			
-			// Assign a unique ID to the slot for proper identification
-			NewSlot.SlotId = FGuid::NewGuid();
-			
-			Slots.Add(NewSlot);
+		for (int32 i = 0; i < Pair.Value; ++i)
+		{
+			Slots.AddSlot(MakeDefaultSlot(Pair.Key, i));
 		}
-		
-		BodyPartSlots.Add(BodyPart, Slots);
 	}
 	
 	// Initialize CoreNodeSlots with default amplification factor
@@ -109,6 +292,44 @@ void UConceptComponent::InitializeSlots()
 	}
 }
 
+FConceptSlot UConceptComponent::MakeDefaultSlot(EBodyPartType BodyPart, int32 Index) const
+{
+	FConceptSlot NewSlot;
+	NewSlot.BodyPart = BodyPart;
+	
+	// Only unlock the first slot for each body part by default
+	NewSlot.bIsUnlocked = (Index == 0);
+	
+	// Set max tier based on body part
+	switch (BodyPart)
+	{
+	case EBodyPartType::Head:
+		NewSlot.MaxTier = EConceptTier::Abstract; // Head can hold the highest tier concepts
+		break;
+	case EBodyPartType::Body:
+		NewSlot.MaxTier = EConceptTier::Advanced;
+		break;
+	case EBodyPartType::Arms:
+		NewSlot.MaxTier = EConceptTier::Intermediate;
+		break;
+	case EBodyPartType::Feet:
+		NewSlot.MaxTier = EConceptTier::Physical;
+		break;
+	default:
+		NewSlot.MaxTier = EConceptTier::Physical;
+		break;
+	}
+	
+	// Assign grid coordinates based on index and GridWidth for inventory system
+	NewSlot.XCoordinate = Index % GridWidth;
+	NewSlot.YCoordinate = Index / GridWidth;
+	
+	// Assign a unique ID to the slot for proper identification
+	NewSlot.SlotId = FGuid::NewGuid();
+	
+	return NewSlot;
+}
+
 bool UConceptComponent::ObserveConcept(UConcept* Concept, float ObservationQuality)
 {
 	if (!Concept)
@@ -117,7 +338,17 @@ bool UConceptComponent::ObserveConcept(UConcept* Concept, float ObservationQuali
 	}
 	
 	// Add to observed concepts
-	ObservedConcepts.Add(Concept);
+	if (!ObservedConcepts.Contains(Concept))
+	{
+		NoteObserved(Concept);
+		ObservedConcepts.Add(Concept);
+		Knowledge.MarkObserved(Concept);
+
+		FConceptJournalRecord Record;
+		Record.Op = EConceptJournalOp::Observe;
+		Record.Concepts.Add(Concept);
+		RecordJournal(Record);
+	}
 	
 	// Calculate acquisition chance based on concept difficulty and observation quality
 	float AcquisitionChance = Concept->BaseAcquisitionChance * ObservationQuality;
@@ -194,144 +425,200 @@ bool UConceptComponent::AcquireConcept(UConcept* Concept, EBodyPartType TargetBo
 	}
 	
 	// Find an empty slot that can hold this concept
-	FConceptSlot EmptySlot;
-	if (!FindEmptySlotForConcept(Concept, TargetBodyPart, EmptySlot))
+	FConceptSlot* EmptySlot = FindEmptySlot(Concept, TargetBodyPart);
+	if (!EmptySlot)
 	{
 		// If no suitable slot found in the target body part, try other body parts
-		bool FoundSlot = false;
-		
-		for (const auto& Pair : BodyPartSlots)
+		for (const auto& Pair : MaxSlotsPerBodyPart)
 		{
 			if (Pair.Key != TargetBodyPart)
 			{
-				if (FindEmptySlotForConcept(Concept, Pair.Key, EmptySlot))
+				EmptySlot = FindEmptySlot(Concept, Pair.Key);
+				if (EmptySlot)
 				{
-					FoundSlot = true;
 					TargetBodyPart = Pair.Key;
 					break;
 				}
 			}
 		}
 		
-		if (!FoundSlot)
+		if (!EmptySlot)
 		{
 			return false; // No suitable slot found in any body part
 		}
 	}
 	
-	// Set the concept in the slot
-	EmptySlot.SetConcept(Concept);
-	
-	// Update the slot in the map
-	UpdateSlot(EmptySlot, TargetBodyPart);
+	// Set the concept in the slot and mark it for replication
+	TouchSlot(*EmptySlot);
+	EmptySlot->SetConcept(Concept);
+	MarkSlotDirty(*EmptySlot);
 	
 	// Add to acquired concepts
+	NoteAcquired(Concept);
 	AcquiredConcepts.Add(Concept);
+	Knowledge.MarkAcquired(Concept);
+	MarkPublicSummaryDirty();
 	
 	// Apply gameplay tags for this concept if we have an ability system component
-	if (AbilitySystemComponent)
+	ApplyConceptTags(Concept, TargetBodyPart);
+
+	// Journaled once the state is complete, since the record can trigger a compaction that snapshots it
+	FConceptJournalRecord Record;
+	Record.Op = EConceptJournalOp::Acquire;
+	Record.SlotIndex = GetSlotIndex(*EmptySlot);
+	Record.Concepts.Add(Concept);
+	Record.BodyPart = TargetBodyPart;
+	RecordJournal(Record);
+	
+	// Broadcast delegate
+	if (!IsPreviewing())
 	{
-		// Add the concept's tier tag
-		FGameplayTag TierTag = FConceptSkillTags::GetConceptTierTag(Concept->Tier);
-		if (TierTag.IsValid())
-		{
-			AbilitySystemComponent->AddLooseGameplayTag(TierTag);
-		}
+		OnConceptAcquired.Broadcast(Concept, *EmptySlot);
+	}
+	
+	return true;
+}
 
-		// Add the concept's tags
-		for (const FGameplayTag& Tag : Concept->ConceptTags)
-		{
-			AbilitySystemComponent->AddLooseGameplayTag(Tag);
-		}
 
-		// Add the body part tag
-		FGameplayTag BodyPartTag = FConceptSkillTags::GetBodyPartTag(TargetBodyPart);
-		if (BodyPartTag.IsValid())
+void UConceptComponent::ApplyConceptTags(UConcept* Concept, EBodyPartType BodyPart)
+{
+	if (!AbilitySystemComponent || !Concept)
+	{
+		return;
+	}
+
+	AddStateTags(GetConceptTags(Concept, BodyPart));
+}
+
+void UConceptComponent::AddStateTags(const FGameplayTagContainer& Tags)
+{
+	if (!AbilitySystemComponent || Tags.IsEmpty())
+	{
+		return;
+	}
+
+	// Previews grant into the scratch list, which their snapshot truncates on restore
+	if (IsPreviewing())
+	{
+		for (const FGameplayTag& Tag : Tags)
 		{
-			AbilitySystemComponent->AddLooseGameplayTag(BodyPartTag);
+			PreviewTags.Add(Tag);
 		}
+		return;
 	}
-	
-	// Broadcast delegate
-	OnConceptAcquired.Broadcast(Concept, EmptySlot);
-	
-	return true;
+
+	AbilitySystemComponent->AddLooseGameplayTags(Tags);
+	NoteTagsAdded(Tags);
 }
 
-void UConceptComponent::GainProgression(float Amount)
+const FGameplayTagContainer& UConceptComponent::GetEffectiveOwnedTags() const
 {
-    if (Amount > 0.0f)
-    {
-        ProgressionPool += Amount;
-        // Optionally, check for automatic unlocks or log progression, but keep it manual for now
-    }
+	const FGameplayTagContainer& OwnedTags = AbilitySystemComponent ? AbilitySystemComponent->GetOwnedGameplayTags() : FGameplayTagContainer::EmptyContainer;
+	if (PreviewTags.Num() == 0)
+	{
+		return OwnedTags;
+	}
+
+	// Rebuilt on every call: previews are short, and the live tags can change underneath them
+	PreviewOwnedTags = OwnedTags;
+	for (const FGameplayTag& Tag : PreviewTags)
+	{
+		PreviewOwnedTags.AddTag(Tag);
+	}
+	return PreviewOwnedTags;
 }
 
-bool UConceptComponent::UnlockConceptSlot(EBodyPartType BodyPart, EConceptTier MaxTier)
+FGameplayTagContainer UConceptComponent::GetConceptTags(const UConcept* Concept, EBodyPartType BodyPart)
 {
-    if (ProgressionPool >= ProgressionCostToUnlockSlot)
-    {
-        ProgressionPool -= ProgressionCostToUnlockSlot;  // Consume progression points
-        // Existing unlock logic; find the first locked slot and unlock it
-        if (BodyPartSlots.Contains(BodyPart))
-        {
-            TArray<FConceptSlot>& Slots = BodyPartSlots[BodyPart];
-            for (auto& Slot : Slots)
-            {
-                if (!Slot.bIsUnlocked)
-                {
-                    Slot.bIsUnlocked = true;
-                    Slot.MaxTier = MaxTier;  // Set the max tier for the slot
-                    OnSlotUnlocked.Broadcast(Slot);  // Broadcast the event
-                    return true;
-                }
-            }
-        }
-        return false;  // No locked slots found, or progression insufficient after check
-    }
-    return false;  // Not enough progression
+	FGameplayTagContainer Tags;
+	if (!Concept)
+	{
+		return Tags;
+	}
+
+	// Add the concept's tier tag
+	FGameplayTag TierTag = FConceptSkillTags::GetConceptTierTag(Concept->Tier);
+	if (TierTag.IsValid())
+	{
+		Tags.AddTag(TierTag);
+	}
+
+	// Add the concept's tags
+	Tags.AppendTags(Concept->ConceptTags);
+
+	// Add the body part tag
+	FGameplayTag BodyPartTag = FConceptSkillTags::GetBodyPartTag(BodyPart);
+	if (BodyPartTag.IsValid())
+	{
+		Tags.AddTag(BodyPartTag);
+	}
+
+	return Tags;
 }
 
-TArray<FConceptSlot> UConceptComponent::GetSlotsForBodyPart(EBodyPartType BodyPart) const
+FGameplayTag UConceptComponent::GetMediatedSkillTag(const FMediatedSkill& Skill)
+{
+	// A tag like 'conceptskill.skill.from.concepts.fire.wind'
+	const FString TagName = FString::Printf(TEXT("ConceptSkill.%s"), *Skill.SkillDescription.Replace(TEXT(" "), TEXT(".")).ToLower());
+	return FGameplayTag::RequestGameplayTag(FName(*TagName), false);
+}
+
+void UConceptComponent::ApplyStateTags()
 {
-	if (BodyPartSlots.Contains(BodyPart))
+	if (!AbilitySystemComponent)
 	{
-		return BodyPartSlots[BodyPart];
+		return;
+	}
+
+	for (const FConceptSlot& Slot : Slots.Items)
+	{
+		ApplyConceptTags(Slot.HeldConcept.Get(), Slot.BodyPart);
+	}
+
+	for (const FMediatedSkill& Skill : MediatedSkills)
+	{
+		const FGameplayTag Tag = GetMediatedSkillTag(Skill);
+		if (Tag.IsValid())
+		{
+			AddStateTags(FGameplayTagContainer(Tag));
+		}
 	}
-	
-	return TArray<FConceptSlot>();
 }
 
-bool UConceptComponent::FindEmptySlotForConcept(UConcept* Concept, EBodyPartType BodyPart, FConceptSlot& OutSlot)
+void UConceptComponent::RemoveStateTags()
 {
-    if (!Concept || !BodyPartSlots.Contains(BodyPart))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("FindEmptySlotForConcept: Invalid concept or body part not found."));
-        return false;
-    }
-    
-    const TArray<FConceptSlot>& Slots = BodyPartSlots[BodyPart];
-    
-    for (const FConceptSlot& Slot : Slots)
-    {
-        UE_LOG(LogTemp, Log, TEXT("Checking slot at X:%d, Y:%d, IsEmpty:%s, Unlocked:%s, CanHoldConcept:%s"), Slot.XCoordinate, Slot.YCoordinate, Slot.IsEmpty() ? TEXT("true") : TEXT("false"), Slot.bIsUnlocked ? TEXT("true") : TEXT("false"), Slot.CanHoldConcept(Concept) ? TEXT("true") : TEXT("false"));
-        if (Slot.IsEmpty() && Slot.bIsUnlocked && Slot.CanHoldConcept(Concept))
-        {
-            OutSlot = Slot;
-            UE_LOG(LogTemp, Log, TEXT("Found empty slot at X:%d, Y:%d"), Slot.XCoordinate, Slot.YCoordinate);
-            return true;
-        }
-    }
-    
-    UE_LOG(LogTemp, Warning, TEXT("No empty slot found for concept in body part %d"), (int32)BodyPart);
-    return false;
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	// Loose tags are counted, so this takes back exactly one grant per held concept and mediated skill
+	for (const FConceptSlot& Slot : Slots.Items)
+	{
+		AbilitySystemComponent->RemoveLooseGameplayTags(GetConceptTags(Slot.HeldConcept.Get(), Slot.BodyPart));
+	}
+
+	for (const FMediatedSkill& Skill : MediatedSkills)
+	{
+		const FGameplayTag Tag = GetMediatedSkillTag(Skill);
+		if (Tag.IsValid())
+		{
+			AbilitySystemComponent->RemoveLooseGameplayTag(Tag);
+		}
+	}
 }
 
 void UConceptComponent::GainProgression(float Amount)
 {
     if (Amount > 0.0f)
     {
+        TouchProgression();
         ProgressionPool += Amount;
+
+        FConceptJournalRecord Record;
+        Record.Op = EConceptJournalOp::Progression;
+        Record.Value = Amount;
+        RecordJournal(Record);
         // Optionally, check for automatic unlocks or log progression, but keep it manual for now
     }
 }
@@ -340,80 +627,106 @@ bool UConceptComponent::UnlockConceptSlot(EBodyPartType BodyPart, EConceptTier M
 {
     if (ProgressionPool >= ProgressionCostToUnlockSlot)
     {
-        ProgressionPool -= ProgressionCostToUnlockSlot;  // Consume progression points
         // Existing unlock logic; find the first locked slot and unlock it
-        if (BodyPartSlots.Contains(BodyPart))
+        for (FConceptSlot& Slot : Slots.Items)
         {
-            TArray<FConceptSlot>& Slots = BodyPartSlots[BodyPart];
-            for (auto& Slot : Slots)
+            if (Slot.BodyPart == BodyPart && !Slot.bIsUnlocked)
             {
-                if (!Slot.bIsUnlocked)
+                TouchProgression();
+                TouchSlot(Slot);
+                ProgressionPool -= ProgressionCostToUnlockSlot;  // Consume progression points
+                Slot.bIsUnlocked = true;
+                Slot.MaxTier = MaxTier;  // Set the max tier for the slot
+                MarkSlotDirty(Slot);
+
+                FConceptJournalRecord Record;
+                Record.Op = EConceptJournalOp::Unlock;
+                Record.SlotIndex = GetSlotIndex(Slot);
+                Record.Tier = MaxTier;
+                Record.Value = ProgressionCostToUnlockSlot;
+                RecordJournal(Record);
+
+                if (!IsPreviewing())
                 {
-                    Slot.bIsUnlocked = true;
-                    Slot.MaxTier = MaxTier;  // Set the max tier for the slot
                     OnSlotUnlocked.Broadcast(Slot);  // Broadcast the event
-                    return true;
                 }
+                return true;
             }
         }
-        return false;  // No locked slots found, or progression insufficient after check
+        return false;  // No locked slots found
     }
     return false;  // Not enough progression
 }
 
 TArray<FConceptSlot> UConceptComponent::GetSlotsForBodyPart(EBodyPartType BodyPart) const
 {
-	if (BodyPartSlots.Contains(BodyPart))
-	{
-		return BodyPartSlots[BodyPart];
-	}
-	
-	return TArray<FConceptSlot>();
+	return Slots.GetSlotsForBodyPart(BodyPart);
+}
+
+TArray<FConceptSlot> UConceptComponent::GetAllSlots() const
+{
+	return Slots.Items;
+}
+
+int32 UConceptComponent::GetHighestMasteryLevel(UConcept* Concept) const
+{
+	return Slots.GetHighestMastery(Concept);
 }
 
 bool UConceptComponent::FindEmptySlotForConcept(UConcept* Concept, EBodyPartType BodyPart, FConceptSlot& OutSlot)
 {
-    if (!Concept || !BodyPartSlots.Contains(BodyPart))
+    if (FConceptSlot* Slot = FindEmptySlot(Concept, BodyPart))
+    {
+        OutSlot = *Slot;
+        return true;
+    }
+    return false;
+}
+
+FConceptSlot* UConceptComponent::FindEmptySlot(UConcept* Concept, EBodyPartType BodyPart)
+{
+    if (!Concept || !MaxSlotsPerBodyPart.Contains(BodyPart))
     {
         UE_LOG(LogTemp, Warning, TEXT("FindEmptySlotForConcept: Invalid concept or body part not found."));
-        return false;
+        return nullptr;
     }
     
-    const TArray<FConceptSlot>& Slots = BodyPartSlots[BodyPart];
-    
-    for (const FConceptSlot& Slot : Slots)
+    for (FConceptSlot& Slot : Slots.Items)
     {
+        if (Slot.BodyPart != BodyPart)
+        {
+            continue;
+        }
+        
         UE_LOG(LogTemp, Log, TEXT("Checking slot at X:%d, Y:%d, IsEmpty:%s, Unlocked:%s, CanHoldConcept:%s"), Slot.XCoordinate, Slot.YCoordinate, Slot.IsEmpty() ? TEXT("true") : TEXT("false"), Slot.bIsUnlocked ? TEXT("true") : TEXT("false"), Slot.CanHoldConcept(Concept) ? TEXT("true") : TEXT("false"));
         if (Slot.IsEmpty() && Slot.bIsUnlocked && Slot.CanHoldConcept(Concept))
         {
-            OutSlot = Slot;
             UE_LOG(LogTemp, Log, TEXT("Found empty slot at X:%d, Y:%d"), Slot.XCoordinate, Slot.YCoordinate);
-            return true;
+            return &Slot;
         }
     }
     
     UE_LOG(LogTemp, Warning, TEXT("No empty slot found for concept in body part %d"), (int32)BodyPart);
-    return false;
+    return nullptr;
 }
 
 bool UConceptComponent::ReconfigureSlot(const FGuid& SlotId, EBodyPartType NewBodyPart, EConceptTier NewMaxTier)
 {
-    EBodyPartType OldBodyPart;
-    FConceptSlot Slot;
-    if (FindSlotById(SlotId, Slot, OldBodyPart))
+    if (FConceptSlot* Slot = FindSlotById(SlotId))
     {
-        // Remove slot from old body part
-        TArray<FConceptSlot>& OldSlots = BodyPartSlots[OldBodyPart];
-        OldSlots.Remove(Slot);
-        
-        // Set new body part and max tier
-        Slot.BodyPart = NewBodyPart;
-        Slot.MaxTier = NewMaxTier;
-        Slot.SlotId = SlotId;  // Preserve slot ID
-        
-        // Add to new body part slots
-        TArray<FConceptSlot>& NewSlots = BodyPartSlots[NewBodyPart];
-        NewSlots.Add(Slot);
+        // Move the slot to the new body part in place so it keeps its ID and replication identity
+        TouchSlot(*Slot);
+        Slot->BodyPart = NewBodyPart;
+        Slot->MaxTier = NewMaxTier;
+        MarkSlotDirty(*Slot);
+        MarkPublicSummaryDirty();
+
+        FConceptJournalRecord Record;
+        Record.Op = EConceptJournalOp::SlotReconfigure;
+        Record.SlotIndex = GetSlotIndex(*Slot);
+        Record.BodyPart = NewBodyPart;
+        Record.Tier = NewMaxTier;
+        RecordJournal(Record);
         
         // Update CoreNode if necessary, but keep it simple for now
         return true;
@@ -428,6 +741,13 @@ bool UConceptComponent::IncreaseCoreNodeAmplification(EBodyPartType BodyPart, fl
         FCoreNodeSlot& CoreSlot = CoreNodeSlots[BodyPart];
         CoreSlot.AmplificationFactor += Amount;  // Increase amplification factor
         CoreSlot.AmplificationFactor = FMath::Clamp(CoreSlot.AmplificationFactor, 1.0f, 5.0f);  // Clamp to reasonable values, e.g., 1.0 to 5.0
+
+        // The clamped result is journaled, so replay lands on the same factor
+        FConceptJournalRecord Record;
+        Record.Op = EConceptJournalOp::CoreNodeAmplification;
+        Record.BodyPart = BodyPart;
+        Record.Value = CoreSlot.AmplificationFactor;
+        RecordJournal(Record);
         return true;
     }
     return false;  // Body part not found or no Core Node slot
@@ -435,35 +755,38 @@ bool UConceptComponent::IncreaseCoreNodeAmplification(EBodyPartType BodyPart, fl
 
 bool UConceptComponent::IncreaseMastery(const FGuid& SlotId, int32 Amount)
 {
-	FConceptSlot FoundSlot;
-	EBodyPartType BodyPart;
-	
-	if (!FindSlotById(SlotId, FoundSlot, BodyPart) || FoundSlot.IsEmpty())
+	FConceptSlot* FoundSlot = FindSlotById(SlotId);
+	if (!FoundSlot || FoundSlot->IsEmpty())
 	{
 		return false;
 	}
 	
-	// Increase mastery
-	FoundSlot.IncreaseMastery(Amount);
-	
-	// Update the slot
-	UpdateSlot(FoundSlot, BodyPart);
+	// Increase mastery and mark only this slot for replication
+	const int32 PreviousMastery = FoundSlot->MasteryLevel;
+	TouchSlot(*FoundSlot);
+	FoundSlot->IncreaseMastery(Amount);
+	MarkSlotDirty(*FoundSlot);
+
+	// Journal the applied delta, not the requested one, so replay can't overshoot the clamp
+	if (FoundSlot->MasteryLevel != PreviousMastery)
+	{
+		FConceptJournalRecord Record;
+		Record.Op = EConceptJournalOp::MasteryDelta;
+		Record.SlotIndex = GetSlotIndex(*FoundSlot);
+		Record.Amount = FoundSlot->MasteryLevel - PreviousMastery;
+		RecordJournal(Record);
+	}
 	
-	// Update ability system component if we have one
-	if (AbilitySystemComponent && FoundSlot.HeldConcept.IsValid())
+	// Update ability levels based on the new mastery
+	if (FoundSlot->HeldConcept.IsValid())
 	{
-		// If this is a UConceptAbilitySystemComponent, update ability levels based on new mastery
-		UConceptAbilitySystemComponent* ConceptASC = Cast<UConceptAbilitySystemComponent>(AbilitySystemComponent);
-		if (ConceptASC)
-		{
-			ConceptASC->UpdateAbilityLevelsFromConceptMastery();
-		}
+		RefreshAbilityLevels();
 	}
 	
 	// Broadcast delegate
-	if (FoundSlot.HeldConcept.IsValid())
+	if (FoundSlot->HeldConcept.IsValid() && !IsPreviewing())
 	{
-		OnConceptMasteryChanged.Broadcast(FoundSlot.HeldConcept.Get(), FoundSlot.MasteryLevel);
+		OnConceptMasteryChanged.Broadcast(FoundSlot->HeldConcept.Get(), FoundSlot->MasteryLevel);
 	}
 	
 	return true;
@@ -479,44 +802,1003 @@ bool UConceptComponent::HasObservedConcept(UConcept* Concept) const
 	return Concept && ObservedConcepts.Contains(Concept);
 }
 
-bool UConceptComponent::FindSlotById(const FGuid& SlotId, FConceptSlot& OutSlot, EBodyPartType& OutBodyPart)
+FConceptSlot* UConceptComponent::FindSlotById(const FGuid& SlotId)
 {
-	for (const auto& Pair : BodyPartSlots)
+	return Slots.FindById(SlotId);
+}
+
+void UConceptComponent::HandleReplicatedSlotChanged(const FConceptSlot& Slot)
+{
+	// Authoritative state supersedes anything a pending prediction would roll back to
+	const int32 SlotIndex = GetSlotIndex(Slot);
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
 	{
-		EBodyPartType BodyPart = Pair.Key;
-		const TArray<FConceptSlot>& Slots = Pair.Value;
-		
-		for (const FConceptSlot& Slot : Slots)
+		Snapshot.Slots.Remove(SlotIndex);
+	}
+	MarkGrammarSlotDirty(SlotIndex);
+
+	// Let client-side listeners react to authoritative slot state
+	if (UConcept* Concept = Slot.HeldConcept.Get())
+	{
+		OnConceptMasteryChanged.Broadcast(Concept, Slot.MasteryLevel);
+	}
+}
+
+void UConceptComponent::HandleReplicatedKnowledgeChanged(const FConceptKnowledgeEntry& Entry)
+{
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
+	{
+		Snapshot.AddedObserved.Remove(Entry.Concept);
+		Snapshot.AddedAcquired.Remove(Entry.Concept);
+	}
+
+	// Mirror the replicated flags into the owner's local sets both ways; a rolled-back acquisition clears its flag
+	if (Entry.bObserved)
+	{
+		ObservedConcepts.Add(Entry.Concept);
+	}
+	else
+	{
+		ObservedConcepts.Remove(Entry.Concept);
+	}
+
+	if (Entry.bAcquired)
+	{
+		AcquiredConcepts.Add(Entry.Concept);
+	}
+	else
+	{
+		AcquiredConcepts.Remove(Entry.Concept);
+	}
+}
+
+void UConceptComponent::HandleReplicatedKnowledgeRemoved(const FConceptKnowledgeEntry& Entry)
+{
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
+	{
+		Snapshot.AddedObserved.Remove(Entry.Concept);
+		Snapshot.AddedAcquired.Remove(Entry.Concept);
+	}
+
+	// The server dropped the entry (a reset or a loaded state), so the concept is no longer known at all
+	ObservedConcepts.Remove(Entry.Concept);
+	AcquiredConcepts.Remove(Entry.Concept);
+}
+
+FConceptPublicSummary UConceptComponent::BuildPublicSummary()
+{
+	FConceptPublicSummary Summary;
+	Summary.TierCounts.SetNumZeroed(static_cast<int32>(EConceptTier::Abstract) + 1);
+
+	TArray<UConcept*> SlottedConcepts;
+	for (const FConceptSlot& Slot : Slots.Items)
+	{
+		UConcept* Concept = Slot.HeldConcept.Get();
+		if (!Concept || SlottedConcepts.Contains(Concept))
+		{
+			continue;
+		}
+
+		SlottedConcepts.Add(Concept);
+		Summary.VisibleTags.AppendTags(Concept->ConceptTags);
+
+		uint8& TierCount = Summary.TierCounts[static_cast<int32>(Concept->Tier)];
+		TierCount = static_cast<uint8>(FMath::Min<int32>(TierCount + 1, MAX_uint8));
+	}
+
+	// Only expose the first few synergies to keep the summary small
+	TArray<FString> Synergies = GetConceptCombinationSynergies(SlottedConcepts);
+	for (int32 i = 0; i < Synergies.Num() && i < MaxPublicSynergies; ++i)
+	{
+		Summary.PublicSynergies.Add(Synergies[i]);
+	}
+
+	return Summary;
+}
+
+void UConceptComponent::MarkPublicSummaryDirty()
+{
+	// Previews are undone before anyone could see them
+	if (bPublicSummaryDirty || IsPreviewing() || !GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+	bPublicSummaryDirty = true;
+
+	// The rebuild runs once SummaryUpdateInterval has passed, however many changes land before then
+	if (UConceptSystemSubsystem* ConceptSystem = UConceptSystemSubsystem::Get(this))
+	{
+		ConceptSystem->QueueSummaryUpdate(this);
+	}
+	else
+	{
+		// Nothing would ever run the queued rebuild, so do it now
+		UpdatePublicSummary();
+	}
+}
+
+void UConceptComponent::UpdatePublicSummary()
+{
+	if (!bPublicSummaryDirty)
+	{
+		return;
+	}
+	bPublicSummaryDirty = false;
+
+	// Only touch the replicated property when something visible actually changed
+	FConceptPublicSummary NewSummary = BuildPublicSummary();
+	if (NewSummary != PublicSummary)
+	{
+		PublicSummary = MoveTemp(NewSummary);
+		OnPublicSummaryChanged.Broadcast(PublicSummary);
+	}
+}
+
+void UConceptComponent::OnRep_PublicSummary()
+{
+	OnPublicSummaryChanged.Broadcast(PublicSummary);
+}
+
+FConceptGrammarValidator* UConceptComponent::SyncGrammarGrid(EBodyPartType BodyPart)
+{
+	if (!Grammar)
+	{
+		GrammarGrids.Remove(BodyPart);
+		return nullptr;
+	}
+
+	FGrammarGrid& Grid = GrammarGrids.FindOrAdd(BodyPart);
+	const int32 Width = FMath::Max(GridWidth, 1);
+
+	// A new grammar, grid size or slot count starts over; otherwise only the dirty slots are written
+	const bool bReset = Grid.Grammar.Get() != Grammar || Grid.CompileVersion != Grammar->GetCompileVersion()
+		|| Grid.Validator.GetWidth() != Width || Grid.CellBySlot.Num() != Slots.Items.Num();
+
+	// Slots past GridHeight grow the grid instead of being dropped
+	int32 Height = bReset ? FMath::Max(GridHeight, 1) : FMath::Max3(GridHeight, Grid.Validator.GetHeight(), 1);
+	auto GrowFor = [BodyPart, Width, &Height](const FConceptSlot& Slot)
+	{
+		if (Slot.BodyPart == BodyPart && Slot.XCoordinate >= 0 && Slot.XCoordinate < Width)
+		{
+			Height = FMath::Max(Height, Slot.YCoordinate + 1);
+		}
+	};
+
+	if (bReset)
+	{
+		for (const FConceptSlot& Slot : Slots.Items)
+		{
+			GrowFor(Slot);
+		}
+	}
+	else
+	{
+		for (const int32 SlotIndex : Grid.DirtySlots)
 		{
-			if (Slot.SlotId == SlotId)
+			if (Slots.Items.IsValidIndex(SlotIndex))
 			{
-				OutSlot = Slot;
-				OutBodyPart = BodyPart;
-				return true;
+				GrowFor(Slots.Items[SlotIndex]);
 			}
 		}
 	}
-	
-	return false;
+
+	TArray<int32> SlotsToSync;
+	if (bReset || Height != Grid.Validator.GetHeight())
+	{
+		Grid.Validator.Reset(&Grammar->GetAutomaton(), Width, Height);
+		Grid.Grammar = Grammar;
+		Grid.CompileVersion = Grammar->GetCompileVersion();
+		Grid.CellBySlot.Init(INDEX_NONE, Slots.Items.Num());
+
+		SlotsToSync.Reserve(Slots.Items.Num());
+		for (int32 SlotIndex = 0; SlotIndex < Slots.Items.Num(); ++SlotIndex)
+		{
+			SlotsToSync.Add(SlotIndex);
+		}
+	}
+	else
+	{
+		SlotsToSync = Grid.DirtySlots.Array();
+	}
+	Grid.DirtySlots.Reset();
+
+	// SetCell only rescans the chains through the cells a slot left and entered
+	for (const int32 SlotIndex : SlotsToSync)
+	{
+		if (!Slots.Items.IsValidIndex(SlotIndex))
+		{
+			continue;
+		}
+
+		const FConceptSlot& Slot = Slots.Items[SlotIndex];
+		UConcept* Concept = Slot.HeldConcept.Get();
+		const bool bOnGrid = Slot.BodyPart == BodyPart && Slot.XCoordinate >= 0 && Slot.XCoordinate < Width && Slot.YCoordinate >= 0;
+		const int32 NewCell = Concept && bOnGrid ? Slot.YCoordinate * Width + Slot.XCoordinate : INDEX_NONE;
+
+		int32& OldCell = Grid.CellBySlot[SlotIndex];
+		if (OldCell != INDEX_NONE && OldCell != NewCell)
+		{
+			Grid.Validator.SetCell(OldCell % Width, OldCell / Width, TOptional<EConceptGrammarRole>());
+		}
+		if (NewCell != INDEX_NONE)
+		{
+			Grid.Validator.SetCell(Slot.XCoordinate, Slot.YCoordinate, Grammar->GetRole(Concept));
+		}
+		OldCell = NewCell;
+
+		// A concept still streaming in takes its cell on a later sync
+		if (!Concept && bOnGrid && !Slot.HeldConcept.IsNull())
+		{
+			Grid.DirtySlots.Add(SlotIndex);
+		}
+	}
+
+	return &Grid.Validator;
 }
 
-void UConceptComponent::UpdateSlot(const FConceptSlot& Slot, EBodyPartType BodyPart)
+void UConceptComponent::MarkGrammarSlotDirty(int32 SlotIndex)
 {
-	if (!BodyPartSlots.Contains(BodyPart))
+	if (SlotIndex == INDEX_NONE)
 	{
 		return;
 	}
-	
-	TArray<FConceptSlot>& Slots = BodyPartSlots[BodyPart];
-	
-	for (int32 i = 0; i < Slots.Num(); ++i)
+
+	for (TPair<EBodyPartType, FGrammarGrid>& Pair : GrammarGrids)
+	{
+		Pair.Value.DirtySlots.Add(SlotIndex);
+	}
+}
+
+FConceptGrammarReport UConceptComponent::ValidateGrammar(EBodyPartType BodyPart)
+{
+	FConceptGrammarReport Report;
+	const FConceptGrammarValidator* Validator = SyncGrammarGrid(BodyPart);
+	if (!Validator)
 	{
-		if (Slots[i].SlotId == Slot.SlotId)
+		return Report;
+	}
+
+	Report.Violations = Validator->GetViolations();
+	Report.Synergy = Validator->GetSynergy();
+	Validator->ForEachMatch([this, &Report](const FConceptGrammarMatch& Match, FIntPoint FirstCell, FIntPoint Step)
+	{
+		const FConceptGrammarRule& Rule = Grammar->Rules[Match.Rule];
+		FConceptGrammarLink& Link = Report.Links.AddDefaulted_GetRef();
+		Link.Rule = Rule.Name;
+		Link.bForbidden = Rule.bForbidden;
+		Link.FirstCell = FirstCell;
+		Link.LastCell = FirstCell + Step * (Match.Length - 1);
+	});
+
+	return Report;
+}
+
+FConceptGrammarReport UConceptComponent::ValidateSlotSequence(EBodyPartType BodyPart)
+{
+	FConceptGrammarReport Report;
+	if (!Grammar)
+	{
+		return Report;
+	}
+
+	const FConceptGrammarAutomaton& Automaton = Grammar->GetAutomaton();
+
+	// Runs of filled slots, in slot order; an empty slot ends a run
+	TArray<const FConceptSlot*> Run;
+	TArray<EConceptGrammarRole> Roles;
+	TArray<FConceptGrammarMatch> Matches;
+	auto ScanRun = [&]()
+	{
+		if (Run.Num() >= 2)
 		{
-			Slots[i] = Slot;
-			break;
+			Matches.Reset();
+			const FConceptGrammarChainResult Result = Automaton.Scan(Roles, &Matches);
+			Report.Violations += Result.Violations;
+			Report.Synergy += Result.Synergy;
+
+			for (const FConceptGrammarMatch& Match : Matches)
+			{
+				const FConceptGrammarRule& Rule = Grammar->Rules[Match.Rule];
+				const FConceptSlot* First = Run[Match.Start];
+				const FConceptSlot* Last = Run[Match.Start + Match.Length - 1];
+				FConceptGrammarLink& Link = Report.Links.AddDefaulted_GetRef();
+				Link.Rule = Rule.Name;
+				Link.bForbidden = Rule.bForbidden;
+				Link.FirstCell = FIntPoint(First->XCoordinate, First->YCoordinate);
+				Link.LastCell = FIntPoint(Last->XCoordinate, Last->YCoordinate);
+			}
 		}
+		Run.Reset();
+		Roles.Reset();
+	};
+
+	for (const FConceptSlot& Slot : Slots.Items)
+	{
+		if (Slot.BodyPart != BodyPart)
+		{
+			continue;
+		}
+
+		UConcept* Concept = Slot.HeldConcept.Get();
+		if (!Concept)
+		{
+			ScanRun();
+			continue;
+		}
+
+		Run.Add(&Slot);
+		Roles.Add(Grammar->GetRole(Concept));
+	}
+	ScanRun();
+
+	return Report;
+}
+
+bool UConceptComponent::SaveConceptState(TArray<uint8>& OutData) const
+{
+	const UConceptRegistry* Registry = UConceptRegistry::GetConceptRegistry(this);
+	if (!Registry)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SaveConceptState: No concept registry available."));
+		return false;
+	}
+
+	OutData.Reset();
+	FConceptSaveWriter Writer(OutData, Registry);
+	Writer.WriteHeader();
+
+	// Sections that are usually at their defaults are flagged rather than always written
+	TArray<TPair<EBodyPartType, float>> AmplifiedCoreNodes;
+	for (const auto& Pair : CoreNodeSlots)
+	{
+		if (Pair.Value.AmplificationFactor != 1.0f)
+		{
+			AmplifiedCoreNodes.Emplace(Pair.Key, Pair.Value.AmplificationFactor);
+		}
+	}
+
+	uint8 SectionFlags = 0;
+	if (ProgressionPool != 0.0f)
+	{
+		SectionFlags |= SaveSection_Progression;
+	}
+	if (AmplifiedCoreNodes.Num() > 0)
+	{
+		SectionFlags |= SaveSection_CoreNodes;
+	}
+	Writer.WriteByte(SectionFlags);
+
+	// Slots, delta-encoded against the slot InitializeSlots would have created
+	TMap<EBodyPartType, int32> BodyPartOrdinals;
+	Writer.WritePacked(Slots.Items.Num());
+	for (const FConceptSlot& Slot : Slots.Items)
+	{
+		int32& Ordinal = BodyPartOrdinals.FindOrAdd(Slot.BodyPart);
+		Writer.WriteByte(static_cast<uint8>(Slot.BodyPart));
+		Writer.WriteSlot(Slot, MakeDefaultSlot(Slot.BodyPart, Ordinal++));
+	}
+
+	Writer.WriteConceptSet(ObservedConcepts);
+	Writer.WriteConceptSet(AcquiredConcepts);
+
+	// Mediated skills; descriptions are derived and rebuilt on load
+	Writer.WritePacked(MediatedSkills.Num());
+	for (const FMediatedSkill& Skill : MediatedSkills)
+	{
+		Writer.WriteByte(Skill.bIsActiveSkill ? 1 : 0);
+		Writer.WritePacked(Skill.Concepts.Num());
+		for (const TSoftObjectPtr<UConcept>& Concept : Skill.Concepts)
+		{
+			Writer.WriteConcept(Concept);
+		}
+	}
+
+	if (SectionFlags & SaveSection_Progression)
+	{
+		Writer.WriteFloat(ProgressionPool);
+	}
+
+	if (SectionFlags & SaveSection_CoreNodes)
+	{
+		Writer.WritePacked(AmplifiedCoreNodes.Num());
+		for (const TPair<EBodyPartType, float>& Pair : AmplifiedCoreNodes)
+		{
+			Writer.WriteByte(static_cast<uint8>(Pair.Key));
+			Writer.WriteFloat(Pair.Value);
+		}
+	}
+
+	Writer.Finish();
+	return true;
+}
+
+bool UConceptComponent::LoadConceptState(const TArray<uint8>& Data)
+{
+	if (GetOwner() && !GetOwner()->HasAuthority())
+	{
+		return false;
+	}
+
+	const UConceptRegistry* Registry = UConceptRegistry::GetConceptRegistry(this);
+	FConceptSaveReader Reader(Data, Registry);
+	if (!Reader.ReadHeader())
+	{
+		return false;
+	}
+
+	const uint8 SectionFlags = Reader.ReadByte();
+
+	// Decode everything first so a truncated blob leaves the current state untouched
+	TArray<FConceptSlot> LoadedSlots;
+	TMap<EBodyPartType, int32> BodyPartOrdinals;
+	const uint32 SlotCount = Reader.ReadPacked();
+	for (uint32 i = 0; i < SlotCount && !Reader.IsError(); ++i)
+	{
+		const EBodyPartType BodyPart = static_cast<EBodyPartType>(FMath::Min<uint8>(Reader.ReadByte(), static_cast<uint8>(EBodyPartType::None)));
+		int32& Ordinal = BodyPartOrdinals.FindOrAdd(BodyPart);
+
+		FConceptSlot& Slot = LoadedSlots.Add_GetRef(MakeDefaultSlot(BodyPart, Ordinal++));
+		Reader.ReadSlot(Slot);
+	}
+
+	TSet<TSoftObjectPtr<UConcept>> LoadedObserved;
+	TSet<TSoftObjectPtr<UConcept>> LoadedAcquired;
+	Reader.ReadConceptSet(LoadedObserved);
+	Reader.ReadConceptSet(LoadedAcquired);
+
+	TArray<FMediatedSkill> LoadedSkills;
+	const uint32 SkillCount = Reader.ReadPacked();
+	for (uint32 i = 0; i < SkillCount && !Reader.IsError(); ++i)
+	{
+		const bool bIsActiveSkill = Reader.ReadByte() != 0;
+
+		TArray<UConcept*> SkillConcepts;
+		const uint32 ConceptCount = Reader.ReadPacked();
+		for (uint32 j = 0; j < ConceptCount && !Reader.IsError(); ++j)
+		{
+			if (UConcept* Concept = Reader.ReadConcept())
+			{
+				SkillConcepts.Add(Concept);
+			}
+		}
+
+		FMediatedSkill& Skill = LoadedSkills.AddDefaulted_GetRef();
+		Skill.Concepts.Append(SkillConcepts);
+		Skill.bIsActiveSkill = bIsActiveSkill;
+		Skill.SkillDescription = BuildMediatedSkillDescription(SkillConcepts, bIsActiveSkill);
+	}
+
+	const float LoadedProgression = (SectionFlags & SaveSection_Progression) ? Reader.ReadFloat() : 0.0f;
+
+	TArray<TPair<EBodyPartType, float>> LoadedCoreNodes;
+	if (SectionFlags & SaveSection_CoreNodes)
+	{
+		const uint32 CoreNodeCount = Reader.ReadPacked();
+		for (uint32 i = 0; i < CoreNodeCount && !Reader.IsError(); ++i)
+		{
+			const EBodyPartType BodyPart = static_cast<EBodyPartType>(Reader.ReadByte());
+			LoadedCoreNodes.Emplace(BodyPart, Reader.ReadFloat());
+		}
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LoadConceptState: Concept state for %s is truncated or corrupt."), *GetNameSafe(GetOwner()));
+		return false;
+	}
+
+	// Loaded state replaces everything a pending snapshot could roll back to
+	OpenSnapshots.Reset();
+	PreviewDepth = 0;
+	PreviewTags.Reset();
+	PreviewMediatedSkills.Reset();
+
+	// Take back the tags the state being replaced granted; they are granted again from the loaded state below
+	RemoveStateTags();
+
+	// Commit straight into the runtime stores; the grammar grids are rebuilt from them on next use
+	GrammarGrids.Reset();
+	Slots.Reset();
+	for (const FConceptSlot& Slot : LoadedSlots)
+	{
+		Slots.AddSlot(Slot);
+	}
+
+	ObservedConcepts = MoveTemp(LoadedObserved);
+	AcquiredConcepts = MoveTemp(LoadedAcquired);
+
+	Knowledge.Reset();
+	for (const TSoftObjectPtr<UConcept>& Concept : ObservedConcepts)
+	{
+		Knowledge.MarkObserved(Concept.Get());
+	}
+	for (const TSoftObjectPtr<UConcept>& Concept : AcquiredConcepts)
+	{
+		Knowledge.MarkAcquired(Concept.Get());
+	}
+
+	MediatedSkills = MoveTemp(LoadedSkills);
+	ProgressionPool = LoadedProgression;
+
+	for (auto& Pair : CoreNodeSlots)
+	{
+		Pair.Value.AmplificationFactor = 1.0f;
+	}
+	for (const TPair<EBodyPartType, float>& Pair : LoadedCoreNodes)
+	{
+		CoreNodeSlots.FindOrAdd(Pair.Key).AmplificationFactor = Pair.Value;
+	}
+
+	// Re-apply the tags that acquisition and mediation would have granted
+	ApplyStateTags();
+
+	if (UConceptAbilitySystemComponent* ConceptASC = Cast<UConceptAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		ConceptASC->UpdateAbilityLevelsFromConceptMastery();
+	}
+
+	MarkPublicSummaryDirty();
+	return true;
+}
+
+bool UConceptComponent::ForgeConcept(AConceptualObject* Object, UConcept* Concept)
+{
+	if (!Object || !Concept || !HasAcquiredConcept(Concept))
+	{
+		return false; // Only acquired concepts can be forged into objects
+	}
+
+	if (!Object->AddConcept(Concept))
+	{
+		return false;
 	}
+
+	// The object saves its own slots; the record keeps who forged what for auditing
+	FConceptJournalRecord Record;
+	Record.Op = EConceptJournalOp::Forge;
+	Record.Concepts.Add(Concept);
+	Record.Target = Object->GetPathName();
+	RecordJournal(Record);
+
+	return true;
+}
+
+void UConceptComponent::SetJournal(TSharedPtr<IConceptJournal> InJournal)
+{
+	if (Journal.IsValid())
+	{
+		Journal->Flush();
+	}
+
+	Journal = InJournal;
+	NextJournalSequence = 1;
+	RecordsSinceCompaction = 0;
+}
+
+bool UConceptComponent::EnableFileJournal(const FString& JournalKey)
+{
+	if (JournalKey.IsEmpty() || (GetOwner() && !GetOwner()->HasAuthority()))
+	{
+		return false;
+	}
+
+	const UConceptRegistry* Registry = UConceptRegistry::GetConceptRegistry(this);
+	SetJournal(MakeShared<FConceptFileJournal>(FPaths::ProjectSavedDir() / TEXT("ConceptJournal"), JournalKey, Registry));
+	if (!RestoreFromJournal())
+	{
+		// Appending now would restart the sequence at 1 behind records that were never replayed
+		UE_LOG(LogTemp, Warning, TEXT("EnableFileJournal: Could not restore journal '%s' for %s; journaling stays off."), *JournalKey, *GetNameSafe(GetOwner()));
+		SetJournal(nullptr);
+		return false;
+	}
+
+	return true;
+}
+
+bool UConceptComponent::RestoreFromJournal()
+{
+	if (!Journal.IsValid())
+	{
+		return false;
+	}
+
+	TArray<uint8> Snapshot;
+	uint32 SnapshotSequence = 0;
+	TArray<FConceptJournalRecord> Records;
+	if (!Journal->Load(Snapshot, SnapshotSequence, Records))
+	{
+		return false;
+	}
+
+	if (Snapshot.Num() > 0 && !LoadConceptState(Snapshot))
+	{
+		return false;
+	}
+
+	// Replay without journaling the replayed mutations again
+	TGuardValue<bool> ReplayGuard(bReplayingJournal, true);
+
+	uint32 LastSequence = SnapshotSequence;
+	for (const FConceptJournalRecord& Record : Records)
+	{
+		ApplyJournalRecord(Record);
+		LastSequence = FMath::Max(LastSequence, Record.Sequence);
+	}
+
+	NextJournalSequence = LastSequence + 1;
+	RecordsSinceCompaction = Records.Num();
+
+	// Rewrite journals from an older save format so new records can be appended
+	if (Journal->NeedsCompaction())
+	{
+		CompactJournal();
+	}
+
+	if (UConceptAbilitySystemComponent* ConceptASC = Cast<UConceptAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		ConceptASC->UpdateAbilityLevelsFromConceptMastery();
+	}
+
+	MarkPublicSummaryDirty();
+	UE_LOG(LogTemp, Log, TEXT("RestoreFromJournal: Replayed %d records on top of snapshot #%u for %s"), Records.Num(), SnapshotSequence, *GetNameSafe(GetOwner()));
+	return true;
+}
+
+bool UConceptComponent::CompactJournal()
+{
+	if (!Journal.IsValid())
+	{
+		return false;
+	}
+
+	TArray<uint8> Snapshot;
+	if (!SaveConceptState(Snapshot) || !Journal->Compact(Snapshot, NextJournalSequence - 1))
+	{
+		return false;
+	}
+
+	RecordsSinceCompaction = 0;
+	return true;
+}
+
+void UConceptComponent::RecordJournal(FConceptJournalRecord& Record)
+{
+	// Replays are already journaled and previews are thrown away
+	if (!Journal.IsValid() || bReplayingJournal || PreviewDepth > 0)
+	{
+		return;
+	}
+
+	Record.Sequence = NextJournalSequence++;
+	Record.Timestamp = FDateTime::UtcNow().GetTicks();
+
+	// A journal written against another catalog can't take records; the state already includes this one, so the snapshot covers it
+	if (Journal->NeedsCompaction())
+	{
+		CompactJournal();
+		return;
+	}
+
+	Journal->Append(Record);
+
+	// Fold the journal into a snapshot once it grows past the threshold
+	if (JournalCompactionThreshold > 0 && ++RecordsSinceCompaction >= JournalCompactionThreshold)
+	{
+		CompactJournal();
+	}
+}
+
+void UConceptComponent::ApplyJournalRecord(const FConceptJournalRecord& Record)
+{
+	FConceptSlot* Slot = Slots.Items.IsValidIndex(Record.SlotIndex) ? &Slots.Items[Record.SlotIndex] : nullptr;
+	UConcept* Concept = Record.Concepts.Num() > 0 ? Record.Concepts[0].Get() : nullptr;
+
+	switch (Record.Op)
+	{
+	case EConceptJournalOp::Acquire:
+		if (Slot && Concept)
+		{
+			Slot->HeldConcept = Concept;
+			Slot->MasteryLevel = 0;
+			MarkSlotDirty(*Slot);
+			AcquiredConcepts.Add(Concept);
+			Knowledge.MarkAcquired(Concept);
+			ApplyConceptTags(Concept, Record.BodyPart);
+		}
+		break;
+	case EConceptJournalOp::MasteryDelta:
+		if (Slot)
+		{
+			Slot->IncreaseMastery(Record.Amount);
+			MarkSlotDirty(*Slot);
+		}
+		break;
+	case EConceptJournalOp::SlotReconfigure:
+		if (Slot)
+		{
+			Slot->BodyPart = Record.BodyPart;
+			Slot->MaxTier = Record.Tier;
+			MarkSlotDirty(*Slot);
+		}
+		break;
+	case EConceptJournalOp::Unlock:
+		if (Slot)
+		{
+			Slot->bIsUnlocked = true;
+			Slot->MaxTier = Record.Tier;
+			MarkSlotDirty(*Slot);
+			ProgressionPool -= Record.Value;
+		}
+		break;
+	case EConceptJournalOp::Mediate:
+	{
+		TArray<UConcept*> SkillConcepts;
+		for (const TSoftObjectPtr<UConcept>& SkillConcept : Record.Concepts)
+		{
+			if (UConcept* Loaded = SkillConcept.Get())
+			{
+				SkillConcepts.Add(Loaded);
+			}
+		}
+		MediateSkill(SkillConcepts, Record.bFlag);
+		break;
+	}
+	case EConceptJournalOp::Forge:
+		break; // Object state is persisted by the object itself
+	case EConceptJournalOp::Observe:
+		if (Concept)
+		{
+			ObservedConcepts.Add(Concept);
+			Knowledge.MarkObserved(Concept);
+		}
+		break;
+	case EConceptJournalOp::Progression:
+		ProgressionPool += Record.Value;
+		break;
+	case EConceptJournalOp::CoreNodeAmplification:
+		CoreNodeSlots.FindOrAdd(Record.BodyPart).AmplificationFactor = Record.Value;
+		break;
+	}
+}
+
+void UConceptComponent::BeginPredictionSnapshot(int32 PredictionKey)
+{
+	if (FindSnapshot(PredictionKey) == INDEX_NONE)
+	{
+		OpenSnapshot(PredictionKey);
+	}
+}
+
+int32 UConceptComponent::BeginPreviewSnapshot()
+{
+	const int32 Key = NextPreviewKey--;
+	if (NextPreviewKey >= 0)
+	{
+		NextPreviewKey = -1; // Wrapped
+	}
+
+	++PreviewDepth;
+	OpenSnapshot(Key);
+	return Key;
+}
+
+bool UConceptComponent::RestoreSnapshot(int32 Key)
+{
+	const int32 SnapshotIndex = FindSnapshot(Key);
+	if (SnapshotIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Only the fields this snapshot saw change are written back. A preview's changes never reached replication,
+	// ability levels or the summary, so undoing them doesn't either.
+	const FConceptStateSnapshot& Snapshot = OpenSnapshots[SnapshotIndex];
+	const bool bIsPreview = Snapshot.Key < 0;
+	for (const TPair<int32, FConceptSlotUndo>& Pair : Snapshot.Slots)
+	{
+		if (Slots.Items.IsValidIndex(Pair.Key))
+		{
+			FConceptSlot& Slot = Slots.Items[Pair.Key];
+			Pair.Value.Restore(Slot);
+			if (!bIsPreview)
+			{
+				Slots.MarkItemDirty(Slot);
+			}
+			MarkGrammarSlotDirty(Pair.Key);
+		}
+	}
+
+	if (Snapshot.ProgressionPool.IsSet())
+	{
+		ProgressionPool = Snapshot.ProgressionPool.GetValue();
+	}
+
+	for (const TSoftObjectPtr<UConcept>& Concept : Snapshot.AddedObserved)
+	{
+		ObservedConcepts.Remove(Concept);
+		Knowledge.ClearObserved(Concept.Get());
+	}
+
+	for (const TSoftObjectPtr<UConcept>& Concept : Snapshot.AddedAcquired)
+	{
+		AcquiredConcepts.Remove(Concept);
+		Knowledge.ClearAcquired(Concept.Get());
+	}
+
+	if (MediatedSkills.Num() > Snapshot.MediatedSkillCount)
+	{
+		MediatedSkills.SetNum(Snapshot.MediatedSkillCount);
+	}
+
+	// A preview's tags and mediated skills only ever reached the scratch copies
+	if (PreviewTags.Num() > Snapshot.PreviewTagCount)
+	{
+		PreviewTags.SetNum(Snapshot.PreviewTagCount);
+	}
+	if (PreviewMediatedSkills.Num() > Snapshot.PreviewMediatedSkillCount)
+	{
+		PreviewMediatedSkills.SetNum(Snapshot.PreviewMediatedSkillCount);
+	}
+
+	if (AbilitySystemComponent)
+	{
+		for (const FGameplayTag& Tag : Snapshot.AddedTags)
+		{
+			AbilitySystemComponent->RemoveLooseGameplayTag(Tag);
+		}
+	}
+
+	// Snapshots opened later were built on top of the state just undone
+	CloseSnapshots(SnapshotIndex);
+
+	if (!bIsPreview)
+	{
+		RefreshAbilityLevels();
+		MarkPublicSummaryDirty();
+	}
+	return true;
+}
+
+void UConceptComponent::CommitSnapshot(int32 Key)
+{
+	const int32 SnapshotIndex = FindSnapshot(Key);
+	if (SnapshotIndex != INDEX_NONE)
+	{
+		if (Key < 0)
+		{
+			--PreviewDepth;
+		}
+		OpenSnapshots.RemoveAt(SnapshotIndex);
+
+		// Scratch state has no live counterpart to commit into; it ends with the last preview
+		if (PreviewDepth == 0)
+		{
+			PreviewTags.Reset();
+			PreviewMediatedSkills.Reset();
+		}
+	}
+}
+
+void UConceptComponent::MarkSlotDirty(FConceptSlot& Slot)
+{
+	// Preview changes are undone before the next replication pass, so the slot is left as it was sent
+	if (!IsPreviewing())
+	{
+		Slots.MarkItemDirty(Slot);
+	}
+
+	// Grammar checks during a preview should see it, and its undo marks the slot again
+	MarkGrammarSlotDirty(GetSlotIndex(Slot));
+}
+
+void UConceptComponent::RefreshAbilityLevels()
+{
+	if (IsPreviewing())
+	{
+		return;
+	}
+
+	if (UConceptAbilitySystemComponent* ConceptASC = Cast<UConceptAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		ConceptASC->UpdateAbilityLevelsFromConceptMastery();
+	}
+}
+
+void UConceptComponent::OpenSnapshot(int32 Key)
+{
+	FConceptStateSnapshot& Snapshot = OpenSnapshots.AddDefaulted_GetRef();
+	Snapshot.Key = Key;
+	Snapshot.MediatedSkillCount = MediatedSkills.Num();
+	Snapshot.PreviewTagCount = PreviewTags.Num();
+	Snapshot.PreviewMediatedSkillCount = PreviewMediatedSkills.Num();
+}
+
+void UConceptComponent::CloseSnapshots(int32 FirstIndex)
+{
+	for (int32 Index = FirstIndex; Index < OpenSnapshots.Num(); ++Index)
+	{
+		if (OpenSnapshots[Index].Key < 0)
+		{
+			--PreviewDepth;
+		}
+	}
+	OpenSnapshots.SetNum(FirstIndex);
+}
+
+int32 UConceptComponent::FindSnapshot(int32 Key) const
+{
+	return OpenSnapshots.IndexOfByPredicate([Key](const FConceptStateSnapshot& Snapshot) { return Snapshot.Key == Key; });
+}
+
+void UConceptComponent::TouchSlot(const FConceptSlot& Slot)
+{
+	if (OpenSnapshots.Num() == 0)
+	{
+		return;
+	}
+
+	// Copy-on-write: only the first change after a snapshot opens saves the original
+	const int32 SlotIndex = GetSlotIndex(Slot);
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
+	{
+		if (!Snapshot.Slots.Contains(SlotIndex))
+		{
+			Snapshot.Slots.Add(SlotIndex).Capture(Slot);
+		}
+	}
+}
+
+void UConceptComponent::TouchProgression()
+{
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
+	{
+		if (!Snapshot.ProgressionPool.IsSet())
+		{
+			Snapshot.ProgressionPool = ProgressionPool;
+		}
+	}
+}
+
+void UConceptComponent::NoteObserved(UConcept* Concept)
+{
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
+	{
+		Snapshot.AddedObserved.Add(Concept);
+	}
+}
+
+void UConceptComponent::NoteAcquired(UConcept* Concept)
+{
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
+	{
+		Snapshot.AddedAcquired.Add(Concept);
+	}
+}
+
+void UConceptComponent::NoteTagsAdded(const FGameplayTagContainer& Tags)
+{
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
+	{
+		for (const FGameplayTag& Tag : Tags)
+		{
+			Snapshot.AddedTags.Add(Tag);
+		}
+	}
+}
+
+void UConceptComponent::OnRep_ProgressionPool()
+{
+	// The server's value replaces whatever a pending prediction saved
+	for (FConceptStateSnapshot& Snapshot : OpenSnapshots)
+	{
+		Snapshot.ProgressionPool.Reset();
+	}
+}
+
+int32 UConceptComponent::GetSlotIndex(const FConceptSlot& Slot) const
+{
+	const int32 Index = static_cast<int32>(&Slot - Slots.Items.GetData());
+	return Slots.Items.IsValidIndex(Index) ? Index : INDEX_NONE;
 }
 
 float UConceptComponent::CalculateCharacterObjectSynergy(UObject* EquippedObject)
@@ -613,33 +1895,25 @@ bool UConceptComponent::MediateSkill(const TArray<UConcept*>& Concepts, bool bIs
     NewSkill.bIsActiveSkill = bIsActiveSkill;
     
     // Generate a simple description based on concepts (can be expanded with a system for emergent effects)
-    FString Description = "Skill from concepts: ";
-    for (auto* Concept : Concepts)
-    {
-        Description += Concept->GetName() + " ";  // Assume UConcept has GetName()
-    }
-    if (bIsActiveSkill)
-    {
-        Description += "(Active)";
-    }
-    else
-    {
-        Description += "(Passive)";
-    }
-    NewSkill.SkillDescription = Description;
+    NewSkill.SkillDescription = BuildMediatedSkillDescription(Concepts, bIsActiveSkill);
     
-    // Add to mediated skills array
-    MediatedSkills.Add(NewSkill);
+    // Add to mediated skills array; a preview's skill stays in the scratch copy so it never replicates
+    (IsPreviewing() ? PreviewMediatedSkills : MediatedSkills).Add(NewSkill);
     
     // After adding the mediated skill, apply a Gameplay Tag for ability integration
-    if (AbilitySystemComponent && MediatedSkills.Num() > 0)
+    const FGameplayTag SkillTag = GetMediatedSkillTag(NewSkill);
+    if (AbilitySystemComponent && SkillTag.IsValid())
     {
-        FGameplayTagContainer TagContainer;
-        FString TagName = FString::Printf(TEXT("ConceptSkill.%s"), *NewSkill.SkillDescription.Replace(TEXT(" "), TEXT(".")).ToLower());  // Generate a tag like 'conceptskill.skill.from.concepts.fire.wind'
-        TagContainer.AddTag(FGameplayTag::RequestGameplayTag(FName(*TagName)));
-        AbilitySystemComponent->AddLooseGameplayTags(TagContainer);  // Apply tag to ability system
-        UE_LOG(LogTemp, Log, TEXT("Applied Gameplay Tag: %s for new skill"), *TagName);
+        AddStateTags(FGameplayTagContainer(SkillTag));  // Apply tag to ability system
+        UE_LOG(LogTemp, Log, TEXT("Applied Gameplay Tag: %s for new skill"), *SkillTag.ToString());
     }
+
+    // Journaled after the state changes, like every other mutator
+    FConceptJournalRecord Record;
+    Record.Op = EConceptJournalOp::Mediate;
+    Record.Concepts = NewSkill.Concepts;
+    Record.bFlag = bIsActiveSkill;
+    RecordJournal(Record);
     
     // Corrected logging to handle concept names array
     TArray<FString> ConceptNames;
@@ -654,6 +1928,27 @@ bool UConceptComponent::MediateSkill(const TArray<UConcept*>& Concepts, bool bIs
     return true;  // Successfully mediated the skill
 }
 
+FString UConceptComponent::BuildMediatedSkillDescription(const TArray<UConcept*>& Concepts, bool bIsActiveSkill)
+{
+    FString Description = "Skill from concepts: ";
+    for (auto* Concept : Concepts)
+    {
+        if (Concept)
+        {
+            Description += Concept->GetName() + " ";
+        }
+    }
+    if (bIsActiveSkill)
+    {
+        Description += "(Active)";
+    }
+    else
+    {
+        Description += "(Passive)";
+    }
+    return Description;
+}
+
 TArray<FString> UConceptComponent::GetMediatedSkills()
 {
     TArray<FString> SkillList;
@@ -662,6 +1957,10 @@ TArray<FString> UConceptComponent::GetMediatedSkills()
         FString SkillString = Skill.SkillDescription;
         SkillList.Add(SkillString);
     }
+    for (const auto& Skill : PreviewMediatedSkills)
+    {
+        SkillList.Add(Skill.SkillDescription);  // Skills mediated by an open preview
+    }
     return SkillList;  // Return descriptions of all mediated skills
 }
 
@@ -0,0 +1,123 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptCooldownWheel.h"
+
+FConceptCooldownWheel::FConceptCooldownWheel(float InResolution)
+	: Resolution(FMath::Max(InResolution, KINDA_SMALL_NUMBER))
+	, Accumulator(0.0f)
+	, CurrentTick(0)
+{
+}
+
+void FConceptCooldownWheel::Add(uint64 Key, float Duration)
+{
+	// Round up so a cooldown never expires early
+	const uint64 DurationTicks = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToInt(Duration / Resolution)));
+	const FEntry Entry = { Key, CurrentTick + DurationTicks };
+
+	// Any entry already scheduled for this key becomes stale
+	Deadlines.Add(Key, Entry.DeadlineTick);
+	Schedule(Entry);
+}
+
+float FConceptCooldownWheel::GetRemaining(uint64 Key) const
+{
+	const uint64* Deadline = Deadlines.Find(Key);
+	return Deadline ? static_cast<float>(*Deadline - CurrentTick) * Resolution - Accumulator : 0.0f;
+}
+
+void FConceptCooldownWheel::Advance(float DeltaTime)
+{
+	Accumulator += DeltaTime;
+	while (Accumulator >= Resolution)
+	{
+		Accumulator -= Resolution;
+		++CurrentTick;
+
+		// Pull coarser levels down as their slot comes due, coarsest first
+		for (int32 Level = NumLevels - 1; Level > 0; --Level)
+		{
+			const int32 Shift = Level * SlotBits;
+			if ((CurrentTick & ((uint64(1) << Shift) - 1)) == 0)
+			{
+				Cascade(Level, static_cast<int32>((CurrentTick >> Shift) & SlotMask));
+			}
+		}
+
+		TArray<FEntry>& Due = Wheel[0][CurrentTick & SlotMask];
+		if (Due.Num() == 0)
+		{
+			continue;
+		}
+
+		TArray<FEntry> Entries = MoveTemp(Due);
+		Due.Reset();
+		for (const FEntry& Entry : Entries)
+		{
+			const uint64* Deadline = Deadlines.Find(Entry.Key);
+			if (!Deadline || *Deadline != Entry.DeadlineTick)
+			{
+				continue; // Restarted or already expired
+			}
+
+			if (Entry.DeadlineTick <= CurrentTick)
+			{
+				Deadlines.Remove(Entry.Key);
+			}
+			else
+			{
+				Schedule(Entry);
+			}
+		}
+	}
+}
+
+void FConceptCooldownWheel::Reset()
+{
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		for (int32 SlotIndex = 0; SlotIndex < SlotsPerLevel; ++SlotIndex)
+		{
+			Wheel[Level][SlotIndex].Reset();
+		}
+	}
+
+	Deadlines.Reset();
+	Accumulator = 0.0f;
+}
+
+void FConceptCooldownWheel::Schedule(const FEntry& Entry)
+{
+	const uint64 Delta = Entry.DeadlineTick > CurrentTick ? Entry.DeadlineTick - CurrentTick : 0;
+
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		const int32 Shift = Level * SlotBits;
+		if (Delta < (uint64(1) << (Shift + SlotBits)))
+		{
+			// Level 0 holds the exact tick; coarser levels hold the block the deadline falls in
+			const uint64 Tick = FMath::Max(Entry.DeadlineTick, CurrentTick + 1);
+			Wheel[Level][(Tick >> Shift) & SlotMask].Add(Entry);
+			return;
+		}
+	}
+
+	// Beyond the wheel's span: park in the furthest top-level slot and re-schedule when it cascades
+	const int32 TopShift = (NumLevels - 1) * SlotBits;
+	Wheel[NumLevels - 1][((CurrentTick >> TopShift) + SlotMask) & SlotMask].Add(Entry);
+}
+
+void FConceptCooldownWheel::Cascade(int32 Level, int32 SlotIndex)
+{
+	TArray<FEntry> Entries = MoveTemp(Wheel[Level][SlotIndex]);
+	Wheel[Level][SlotIndex].Reset();
+
+	for (const FEntry& Entry : Entries)
+	{
+		const uint64* Deadline = Deadlines.Find(Entry.Key);
+		if (Deadline && *Deadline == Entry.DeadlineTick)
+		{
+			Schedule(Entry);
+		}
+	}
+}
@@ -0,0 +1,292 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptGrammar.h"
+#include "ConceptGrammarValidator.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+void FConceptGrammarAutomaton::Compile(TConstArrayView<FConceptGrammarRule> Rules)
+{
+	Transitions.Reset();
+	OutputLinks.Reset();
+	OutputStarts.Reset();
+	Outputs.Reset();
+	Forbidden.Reset();
+	Synergy.Reset();
+	RuleLengths.Reset();
+
+	// Trie of the patterns; missing transitions stay INDEX_NONE until the breadth-first pass fills them
+	Transitions.Init(INDEX_NONE, NumRoles);
+	TArray<TArray<int32, TInlineAllocator<1>>> StateRules;
+	StateRules.AddDefaulted();
+	Forbidden.Add(false);
+	Synergy.Add(0.0f);
+
+	for (int32 RuleIndex = 0; RuleIndex < Rules.Num(); ++RuleIndex)
+	{
+		const FConceptGrammarRule& Rule = Rules[RuleIndex];
+		RuleLengths.Add(Rule.Pattern.Num());
+		if (Rule.Pattern.Num() < 2)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Grammar rule %s: a pattern needs two or more roles to link concepts"), *Rule.Name.ToString());
+			continue;
+		}
+
+		int32 State = 0;
+		for (const EConceptGrammarRole Role : Rule.Pattern)
+		{
+			const int32 Edge = State * NumRoles + static_cast<int32>(Role);
+			if (Transitions[Edge] == INDEX_NONE)
+			{
+				Transitions[Edge] = StateRules.Num();
+				StateRules.AddDefaulted();
+				Forbidden.Add(false);
+				Synergy.Add(0.0f);
+				for (int32 NewRole = 0; NewRole < NumRoles; ++NewRole)
+				{
+					Transitions.Add(INDEX_NONE);
+				}
+			}
+			State = Transitions[Edge];
+		}
+
+		StateRules[State].Add(RuleIndex);
+		if (Rule.bForbidden)
+		{
+			Forbidden[State] = true;
+		}
+		else
+		{
+			Synergy[State] += Rule.Synergy;
+		}
+	}
+
+	const int32 NumStates = StateRules.Num();
+	OutputLinks.Init(INDEX_NONE, NumStates);
+	TArray<int32> Fail;
+	Fail.Init(0, NumStates);
+
+	// Breadth-first, so a state's failure state (always shallower) is complete before the state is visited
+	TArray<int32> Queue;
+	Queue.Reserve(NumStates);
+	for (int32 Role = 0; Role < NumRoles; ++Role)
+	{
+		int32& Next = Transitions[Role];
+		if (Next == INDEX_NONE)
+		{
+			Next = 0;
+		}
+		else
+		{
+			Queue.Add(Next);
+		}
+	}
+
+	for (int32 Head = 0; Head < Queue.Num(); ++Head)
+	{
+		const int32 State = Queue[Head];
+		const int32 FailState = Fail[State];
+
+		// Everything a suffix matches, this state matches too
+		Forbidden[State] = Forbidden[State] || Forbidden[FailState];
+		Synergy[State] += Synergy[FailState];
+		OutputLinks[State] = StateRules[FailState].Num() > 0 ? FailState : OutputLinks[FailState];
+
+		for (int32 Role = 0; Role < NumRoles; ++Role)
+		{
+			int32& Next = Transitions[State * NumRoles + Role];
+			if (Next == INDEX_NONE)
+			{
+				Next = Transitions[FailState * NumRoles + Role];
+			}
+			else
+			{
+				Fail[Next] = Transitions[FailState * NumRoles + Role];
+				Queue.Add(Next);
+			}
+		}
+	}
+
+	OutputStarts.Reserve(NumStates + 1);
+	OutputStarts.Add(0);
+	for (const TArray<int32, TInlineAllocator<1>>& Own : StateRules)
+	{
+		Outputs.Append(Own);
+		OutputStarts.Add(Outputs.Num());
+	}
+}
+
+FConceptGrammarChainResult FConceptGrammarAutomaton::Scan(TConstArrayView<EConceptGrammarRole> Chain, TArray<FConceptGrammarMatch>* OutMatches) const
+{
+	FConceptGrammarChainResult Result;
+	if (IsEmpty())
+	{
+		return Result;
+	}
+
+	int32 State = 0;
+	for (int32 Position = 0; Position < Chain.Num(); ++Position)
+	{
+		State = Step(State, Chain[Position]);
+		Result.Violations += Forbidden[State] ? 1 : 0;
+		Result.Synergy += Synergy[State];
+
+		if (OutMatches)
+		{
+			ForEachMatch(State, [this, OutMatches, Position](int32 Rule)
+			{
+				OutMatches->Add({ Rule, Position - RuleLengths[Rule] + 1, RuleLengths[Rule] });
+			});
+		}
+	}
+
+	return Result;
+}
+
+UConceptGrammar::UConceptGrammar()
+{
+	CompileVersion = 0;
+
+	// Physical concepts act as verbs, the rest as adjectives and nouns
+	TierRoles.Add(EConceptTier::Physical, EConceptGrammarRole::Verb);
+	TierRoles.Add(EConceptTier::Intermediate, EConceptGrammarRole::Adjective);
+	TierRoles.Add(EConceptTier::Advanced, EConceptGrammarRole::Noun);
+	TierRoles.Add(EConceptTier::Abstract, EConceptGrammarRole::Noun);
+
+	auto AddRule = [this](const TCHAR* Name, TArray<EConceptGrammarRole> Pattern, bool bForbidden)
+	{
+		FConceptGrammarRule& Rule = Rules.AddDefaulted_GetRef();
+		Rule.Name = Name;
+		Rule.Pattern = MoveTemp(Pattern);
+		Rule.bForbidden = bForbidden;
+	};
+
+	// A verb can not sit next to another verb
+	AddRule(TEXT("VerbVerb"), { EConceptGrammarRole::Verb, EConceptGrammarRole::Verb }, true);
+	AddRule(TEXT("AdjectiveVerb"), { EConceptGrammarRole::Adjective, EConceptGrammarRole::Verb }, false);
+	AddRule(TEXT("AdverbVerb"), { EConceptGrammarRole::Adverb, EConceptGrammarRole::Verb }, false);
+	AddRule(TEXT("NounVerb"), { EConceptGrammarRole::Noun, EConceptGrammarRole::Verb }, false);
+	AddRule(TEXT("VerbNoun"), { EConceptGrammarRole::Verb, EConceptGrammarRole::Noun }, false);
+	AddRule(TEXT("AdjectiveNoun"), { EConceptGrammarRole::Adjective, EConceptGrammarRole::Noun }, false);
+}
+
+EConceptGrammarRole UConceptGrammar::GetRole(const UConcept* Concept) const
+{
+	if (!Concept)
+	{
+		return EConceptGrammarRole::Noun;
+	}
+
+	for (const FConceptGrammarTagRole& TagRole : TagRoles)
+	{
+		if (Concept->ConceptTags.HasTag(TagRole.Tag))
+		{
+			return TagRole.Role;
+		}
+	}
+
+	const EConceptGrammarRole* Role = TierRoles.Find(Concept->Tier);
+	return Role ? *Role : EConceptGrammarRole::Noun;
+}
+
+void UConceptGrammar::Compile()
+{
+	Automaton.Compile(Rules);
+	++CompileVersion;
+}
+
+const FConceptGrammarAutomaton& UConceptGrammar::GetAutomaton()
+{
+	if (CompileVersion == 0)
+	{
+		Compile();
+	}
+
+	return Automaton;
+}
+
+void UConceptGrammar::PostLoad()
+{
+	Super::PostLoad();
+
+	Compile();
+}
+
+#if WITH_EDITOR
+void UConceptGrammar::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	Compile();
+}
+#endif
+
+// Random grammar and grid, timed: compile, full validation, single-cell edits, and a long sequence scan
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ConceptGrammarBenchmarkCommand(
+	TEXT("ConceptSkill.GrammarBenchmark"),
+	TEXT("Time grammar compilation and validation: ConceptSkill.GrammarBenchmark [Rules=10000] [GridSize=256] [Edits=10000]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const int32 NumRules = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10000;
+		const int32 GridSize = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 2) : 256;
+		const int32 NumEdits = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 1) : 10000;
+
+		FRandomStream Random(NumRules);
+		auto RandomRole = [&Random]() { return static_cast<EConceptGrammarRole>(Random.RandHelper(FConceptGrammarAutomaton::NumRoles)); };
+
+		TArray<FConceptGrammarRule> Rules;
+		Rules.SetNum(NumRules);
+		for (FConceptGrammarRule& Rule : Rules)
+		{
+			Rule.Pattern.SetNum(Random.RandRange(2, 6));
+			for (EConceptGrammarRole& Role : Rule.Pattern)
+			{
+				Role = RandomRole();
+			}
+			Rule.bForbidden = Random.FRand() < 0.1f;
+		}
+
+		double Start = FPlatformTime::Seconds();
+		FConceptGrammarAutomaton Automaton;
+		Automaton.Compile(Rules);
+		const double CompileMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		FConceptGrammarValidator Validator;
+		Validator.Reset(&Automaton, GridSize, GridSize);
+		for (int32 Y = 0; Y < GridSize; ++Y)
+		{
+			for (int32 X = 0; X < GridSize; ++X)
+			{
+				Validator.SetCell(X, Y, Random.FRand() < 0.2f ? TOptional<EConceptGrammarRole>() : TOptional<EConceptGrammarRole>(RandomRole()));
+			}
+		}
+
+		Start = FPlatformTime::Seconds();
+		Validator.ValidateAll();
+		const double ValidateMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Edit = 0; Edit < NumEdits; ++Edit)
+		{
+			const int32 X = Random.RandHelper(GridSize);
+			const int32 Y = Random.RandHelper(GridSize);
+			Validator.SetCell(X, Y, Random.FRand() < 0.2f ? TOptional<EConceptGrammarRole>() : TOptional<EConceptGrammarRole>(RandomRole()));
+		}
+		const double EditUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumEdits;
+
+		TArray<EConceptGrammarRole> Sequence;
+		Sequence.SetNum(GridSize * GridSize);
+		for (EConceptGrammarRole& Role : Sequence)
+		{
+			Role = RandomRole();
+		}
+
+		Start = FPlatformTime::Seconds();
+		const FConceptGrammarChainResult SequenceResult = Automaton.Scan(Sequence);
+		const double ScanMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Ar.Logf(TEXT("Grammar: %d rules, %d states, compiled in %.2f ms"), NumRules, Automaton.NumStates(), CompileMs);
+		Ar.Logf(TEXT("Grid %dx%d: %d chains, %d violations, validated in %.2f ms; %.2f us per edit over %d edits"),
+			GridSize, GridSize, Validator.NumChains(), Validator.GetViolations(), ValidateMs, EditUs, NumEdits);
+		Ar.Logf(TEXT("Sequence of %d roles: %d violations, scanned in %.2f ms"), Sequence.Num(), SequenceResult.Violations, ScanMs);
+	}));
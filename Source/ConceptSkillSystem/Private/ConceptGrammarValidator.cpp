@@ -0,0 +1,207 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptGrammarValidator.h"
+
+namespace ConceptGrammarValidator
+{
+	static const FIntPoint RowStep(1, 0);
+	static const FIntPoint ColumnStep(0, 1);
+}
+
+void FConceptGrammarValidator::Reset(const FConceptGrammarAutomaton* InAutomaton, int32 InWidth, int32 InHeight)
+{
+	Automaton = InAutomaton;
+	Width = FMath::Max(InWidth, 0);
+	Height = FMath::Max(InHeight, 0);
+	Cells.Init(EmptyCell, Width * Height);
+	RowChains.Reset();
+	ColumnChains.Reset();
+	Violations = 0;
+	Synergy = 0.0f;
+}
+
+void FConceptGrammarValidator::SetCell(int32 X, int32 Y, TOptional<EConceptGrammarRole> Role)
+{
+	using namespace ConceptGrammarValidator;
+
+	if (!Automaton || X < 0 || Y < 0 || X >= Width || Y >= Height)
+	{
+		return;
+	}
+
+	const uint8 NewValue = Role.IsSet() ? static_cast<uint8>(Role.GetValue()) : EmptyCell;
+	if (Cells[Y * Width + X] == NewValue)
+	{
+		return;
+	}
+
+	// Filling or emptying a cell can merge or split the runs on either side of it, so both neighbours are included
+	const FIntPoint Cell(X, Y);
+	RemoveChainsAround(Cell, RowStep, RowChains);
+	RemoveChainsAround(Cell, ColumnStep, ColumnChains);
+
+	Cells[Y * Width + X] = NewValue;
+
+	ScanChainsAround(Cell, RowStep, RowChains);
+	ScanChainsAround(Cell, ColumnStep, ColumnChains);
+}
+
+TOptional<EConceptGrammarRole> FConceptGrammarValidator::GetCell(int32 X, int32 Y) const
+{
+	if (!IsOccupied(X, Y))
+	{
+		return TOptional<EConceptGrammarRole>();
+	}
+
+	return static_cast<EConceptGrammarRole>(Cells[Y * Width + X]);
+}
+
+void FConceptGrammarValidator::ValidateAll()
+{
+	using namespace ConceptGrammarValidator;
+
+	RowChains.Reset();
+	ColumnChains.Reset();
+	Violations = 0;
+	Synergy = 0.0f;
+
+	if (!Automaton)
+	{
+		return;
+	}
+
+	// A run is found from its first cell; the other cells are skipped by the run length
+	TArray<EConceptGrammarRole, TInlineAllocator<32>> Run;
+	auto ScanLine = [this, &Run](FIntPoint Cell, FIntPoint Step, int32 Length, TMap<int32, FConceptGrammarChainResult>& Chains)
+	{
+		for (int32 Position = 0; Position < Length;)
+		{
+			if (!IsOccupied(Cell.X, Cell.Y))
+			{
+				Cell += Step;
+				++Position;
+				continue;
+			}
+
+			ReadRun(Cell, Step, Run);
+			if (Run.Num() >= 2)
+			{
+				const FConceptGrammarChainResult Result = Automaton->Scan(Run);
+				Chains.Add(Cell.Y * Width + Cell.X, Result);
+				Violations += Result.Violations;
+				Synergy += Result.Synergy;
+			}
+
+			Cell += Step * Run.Num();
+			Position += Run.Num();
+		}
+	};
+
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		ScanLine(FIntPoint(0, Y), RowStep, Width, RowChains);
+	}
+
+	for (int32 X = 0; X < Width; ++X)
+	{
+		ScanLine(FIntPoint(X, 0), ColumnStep, Height, ColumnChains);
+	}
+}
+
+void FConceptGrammarValidator::ForEachMatch(TFunctionRef<void(const FConceptGrammarMatch&, FIntPoint, FIntPoint)> Visit) const
+{
+	using namespace ConceptGrammarValidator;
+
+	if (!Automaton)
+	{
+		return;
+	}
+
+	TArray<EConceptGrammarRole, TInlineAllocator<32>> Run;
+	TArray<FConceptGrammarMatch> Matches;
+	auto ParseChains = [&](const TMap<int32, FConceptGrammarChainResult>& Chains, FIntPoint Step)
+	{
+		for (const TPair<int32, FConceptGrammarChainResult>& Chain : Chains)
+		{
+			const FIntPoint Start(Chain.Key % Width, Chain.Key / Width);
+			ReadRun(Start, Step, Run);
+
+			Matches.Reset();
+			Automaton->Scan(Run, &Matches);
+			for (const FConceptGrammarMatch& Match : Matches)
+			{
+				Visit(Match, Start + Step * Match.Start, Step);
+			}
+		}
+	};
+
+	ParseChains(RowChains, RowStep);
+	ParseChains(ColumnChains, ColumnStep);
+}
+
+FIntPoint FConceptGrammarValidator::FindRunStart(FIntPoint Cell, FIntPoint Step) const
+{
+	while (IsOccupied(Cell.X - Step.X, Cell.Y - Step.Y))
+	{
+		Cell -= Step;
+	}
+	return Cell;
+}
+
+void FConceptGrammarValidator::RemoveChainsAround(FIntPoint Cell, FIntPoint Step, TMap<int32, FConceptGrammarChainResult>& Chains)
+{
+	for (int32 Offset = -1; Offset <= 1; ++Offset)
+	{
+		const FIntPoint Neighbour = Cell + Step * Offset;
+		if (!IsOccupied(Neighbour.X, Neighbour.Y))
+		{
+			continue;
+		}
+
+		const FIntPoint Start = FindRunStart(Neighbour, Step);
+		FConceptGrammarChainResult Removed;
+		if (Chains.RemoveAndCopyValue(Start.Y * Width + Start.X, Removed))
+		{
+			Violations -= Removed.Violations;
+			Synergy -= Removed.Synergy;
+		}
+	}
+}
+
+void FConceptGrammarValidator::ScanChainsAround(FIntPoint Cell, FIntPoint Step, TMap<int32, FConceptGrammarChainResult>& Chains)
+{
+	TArray<EConceptGrammarRole, TInlineAllocator<32>> Run;
+	for (int32 Offset = -1; Offset <= 1; ++Offset)
+	{
+		const FIntPoint Neighbour = Cell + Step * Offset;
+		if (!IsOccupied(Neighbour.X, Neighbour.Y))
+		{
+			continue;
+		}
+
+		const FIntPoint Start = FindRunStart(Neighbour, Step);
+		const int32 Key = Start.Y * Width + Start.X;
+		if (Chains.Contains(Key))
+		{
+			continue;
+		}
+
+		ReadRun(Start, Step, Run);
+		if (Run.Num() >= 2)
+		{
+			const FConceptGrammarChainResult Result = Automaton->Scan(Run);
+			Chains.Add(Key, Result);
+			Violations += Result.Violations;
+			Synergy += Result.Synergy;
+		}
+	}
+}
+
+void FConceptGrammarValidator::ReadRun(FIntPoint Start, FIntPoint Step, TArray<EConceptGrammarRole, TInlineAllocator<32>>& OutRun) const
+{
+	OutRun.Reset();
+	for (FIntPoint Cell = Start; IsOccupied(Cell.X, Cell.Y); Cell += Step)
+	{
+		OutRun.Add(static_cast<EConceptGrammarRole>(Cells[Cell.Y * Width + Cell.X]));
+	}
+}
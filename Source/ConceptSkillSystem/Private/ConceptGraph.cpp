@@ -0,0 +1,313 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptGraph.h"
+#include "ConceptCatalog.h"
+
+namespace ConceptGraph
+{
+	// Visited sets for catalogs up to 16k concepts stay on the stack
+	using FVisitedBits = TArray<uint64, TInlineAllocator<256>>;
+
+	static bool TestBit(const uint64* Bits, int32 Index)
+	{
+		return (Bits[Index >> 6] >> (Index & 63)) & 1;
+	}
+
+	static void SetBit(uint64* Bits, int32 Index)
+	{
+		Bits[Index >> 6] |= uint64(1) << (Index & 63);
+	}
+}
+
+void FConceptGraph::BreadthFirst(const FConceptCatalog& Catalog, int32 Start, int32 MaxHops, TArray<int32>& OutConcepts, TArray<int32>* OutHops)
+{
+	using namespace ConceptGraph;
+
+	OutConcepts.Reset();
+	if (OutHops)
+	{
+		OutHops->Reset();
+	}
+
+	if (!Catalog.Concepts.IsValidIndex(Start) || MaxHops == 0)
+	{
+		return;
+	}
+
+	FVisitedBits Visited;
+	Visited.SetNumZeroed(Catalog.MaskWords);
+
+	// The output doubles as the queue; Hops runs alongside it
+	TArray<int32> LocalHops;
+	TArray<int32>& Hops = OutHops ? *OutHops : LocalHops;
+
+	auto Visit = [&](int32 Concept, int32 Distance)
+	{
+		if (!TestBit(Visited.GetData(), Concept))
+		{
+			SetBit(Visited.GetData(), Concept);
+			OutConcepts.Add(Concept);
+			Hops.Add(Distance);
+		}
+	};
+
+	for (const uint32 Next : Catalog.GetRelatedConcepts(Start))
+	{
+		Visit(Next, 1);
+	}
+
+	for (int32 Head = 0; Head < OutConcepts.Num(); ++Head)
+	{
+		const int32 Distance = Hops[Head];
+		if (MaxHops >= 0 && Distance >= MaxHops)
+		{
+			// Breadth-first order: everything after this is at least as far
+			break;
+		}
+
+		for (const uint32 Next : Catalog.GetRelatedConcepts(OutConcepts[Head]))
+		{
+			Visit(Next, Distance + 1);
+		}
+	}
+}
+
+void FConceptGraph::GetKHopMask(const FConceptCatalog& Catalog, int32 Start, int32 K, TArray<uint64>& OutMask)
+{
+	using namespace ConceptGraph;
+
+	OutMask.Reset();
+	OutMask.SetNumZeroed(Catalog.MaskWords);
+	if (!Catalog.Concepts.IsValidIndex(Start) || K < 0)
+	{
+		return;
+	}
+
+	if (K == 0)
+	{
+		SetBit(OutMask.GetData(), Start);
+		return;
+	}
+
+	// Expand one frontier per hop; Seen keeps concepts from being expanded twice
+	FVisitedBits Seen;
+	Seen.SetNumZeroed(Catalog.MaskWords);
+	SetBit(Seen.GetData(), Start);
+
+	TArray<int32> Frontier = { Start };
+	TArray<int32> Next;
+	for (int32 Hop = 1; Hop <= K && Frontier.Num() > 0; ++Hop)
+	{
+		Next.Reset();
+		for (const int32 Concept : Frontier)
+		{
+			for (const uint32 Related : Catalog.GetRelatedConcepts(Concept))
+			{
+				if (!TestBit(Seen.GetData(), Related))
+				{
+					SetBit(Seen.GetData(), Related);
+					Next.Add(Related);
+				}
+			}
+		}
+		Swap(Frontier, Next);
+	}
+
+	for (const int32 Concept : Frontier)
+	{
+		SetBit(OutMask.GetData(), Concept);
+	}
+}
+
+bool FConceptGraph::CanReach(const FConceptCatalog& Catalog, int32 From, int32 To)
+{
+	using namespace ConceptGraph;
+
+	if (!Catalog.Concepts.IsValidIndex(From) || !Catalog.Concepts.IsValidIndex(To))
+	{
+		return false;
+	}
+
+	const int32 FromComponent = Catalog.ConceptComponents[From];
+	const int32 ToComponent = Catalog.ConceptComponents[To];
+	if (FromComponent == ToComponent)
+	{
+		return From != To || Catalog.CyclicComponents[FromComponent];
+	}
+
+	// Links never lead to a later component, so a later target is unreachable
+	if (ToComponent > FromComponent)
+	{
+		return false;
+	}
+
+	FVisitedBits Visited;
+	Visited.SetNumZeroed(Catalog.MaskWords);
+	TArray<int32, TInlineAllocator<64>> Stack = { From };
+	SetBit(Visited.GetData(), From);
+
+	while (Stack.Num() > 0)
+	{
+		const int32 Concept = Stack.Pop(false);
+		for (const uint32 Next : Catalog.GetRelatedConcepts(Concept))
+		{
+			if (static_cast<int32>(Next) == To)
+			{
+				return true;
+			}
+
+			// Components numbered below the target's can't lead back up to it
+			if (Catalog.ConceptComponents[Next] >= ToComponent && !TestBit(Visited.GetData(), Next))
+			{
+				SetBit(Visited.GetData(), Next);
+				Stack.Add(Next);
+			}
+		}
+	}
+
+	return false;
+}
+
+bool FConceptGraph::CanReachTier(const FConceptCatalog& Catalog, int32 Concept, EConceptTier Tier)
+{
+	const TConstArrayView<uint64> Mask = Catalog.GetTierReachMask(Tier);
+	return Catalog.Concepts.IsValidIndex(Concept) && Mask.Num() > 0 && ConceptGraph::TestBit(Mask.GetData(), Concept);
+}
+
+void FConceptGraph::BuildReachability(TConstArrayView<uint32> Starts, TConstArrayView<uint32> Links, TConstArrayView<uint8> Tiers, int32 NumTiers, int32 MaskWords,
+	TArray<int32>& OutComponents, TArray<bool>& OutCyclic, TArray<uint64>& OutTierReach)
+{
+	using namespace ConceptGraph;
+
+	const int32 NumNodes = Tiers.Num();
+	check(NumTiers <= 8);
+
+	OutComponents.Init(INDEX_NONE, NumNodes);
+	OutCyclic.Reset();
+	OutTierReach.Reset();
+	OutTierReach.SetNumZeroed(NumTiers * MaskWords);
+
+	// Iterative Tarjan: catalogs can be deep enough to overflow the call stack
+	struct FFrame
+	{
+		int32 Node;
+		uint32 NextLink;
+	};
+
+	TArray<int32> Order;
+	TArray<int32> LowLink;
+	Order.Init(INDEX_NONE, NumNodes);
+	LowLink.SetNumUninitialized(NumNodes);
+
+	TArray<int32> Stack;
+	TArray<bool> OnStack;
+	OnStack.Init(false, NumNodes);
+	TArray<FFrame> CallStack;
+	int32 NextOrder = 0;
+
+	// Tiers a component contains, and tiers reachable from it through one or more links
+	TArray<uint8> OwnTiers;
+	TArray<uint8> ReachTiers;
+
+	for (int32 Root = 0; Root < NumNodes; ++Root)
+	{
+		if (Order[Root] != INDEX_NONE)
+		{
+			continue;
+		}
+
+		Order[Root] = LowLink[Root] = NextOrder++;
+		Stack.Add(Root);
+		OnStack[Root] = true;
+		CallStack.Add({ Root, Starts[Root] });
+
+		while (CallStack.Num() > 0)
+		{
+			FFrame& Frame = CallStack.Last();
+			const int32 Node = Frame.Node;
+
+			if (Frame.NextLink < Starts[Node + 1])
+			{
+				const int32 Next = Links[Frame.NextLink++];
+				if (Order[Next] == INDEX_NONE)
+				{
+					Order[Next] = LowLink[Next] = NextOrder++;
+					Stack.Add(Next);
+					OnStack[Next] = true;
+					CallStack.Add({ Next, Starts[Next] });
+				}
+				else if (OnStack[Next])
+				{
+					LowLink[Node] = FMath::Min(LowLink[Node], Order[Next]);
+				}
+				continue;
+			}
+
+			CallStack.Pop(false);
+			if (CallStack.Num() > 0)
+			{
+				const int32 Parent = CallStack.Last().Node;
+				LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[Node]);
+			}
+
+			if (LowLink[Node] != Order[Node])
+			{
+				continue;
+			}
+
+			// Node roots a component; every component it links to is already complete
+			const int32 Component = OwnTiers.Num();
+			uint8 Own = 0;
+			uint8 Reach = 0;
+			bool bCyclic = false;
+			const int32 First = Stack.FindLast(Node);
+			for (int32 Index = First; Index < Stack.Num(); ++Index)
+			{
+				const int32 Member = Stack[Index];
+				OnStack[Member] = false;
+				OutComponents[Member] = Component;
+				Own |= uint8(1) << Tiers[Member];
+			}
+
+			for (int32 Index = First; Index < Stack.Num(); ++Index)
+			{
+				const int32 Member = Stack[Index];
+				for (uint32 Link = Starts[Member]; Link < Starts[Member + 1]; ++Link)
+				{
+					const int32 LinkedComponent = OutComponents[Links[Link]];
+					if (LinkedComponent == Component)
+					{
+						bCyclic = true;
+					}
+					else
+					{
+						Reach |= OwnTiers[LinkedComponent] | ReachTiers[LinkedComponent];
+					}
+				}
+			}
+
+			// Members of a cycle reach each other, and so their own tiers
+			bCyclic |= Stack.Num() - First > 1;
+			if (bCyclic)
+			{
+				Reach |= Own;
+			}
+
+			for (int32 Index = First; Index < Stack.Num(); ++Index)
+			{
+				for (int32 Tier = 0; Tier < NumTiers; ++Tier)
+				{
+					if (Reach & (uint8(1) << Tier))
+					{
+						SetBit(OutTierReach.GetData() + Tier * MaskWords, Stack[Index]);
+					}
+				}
+			}
+
+			OwnTiers.Add(Own);
+			ReachTiers.Add(Reach);
+			OutCyclic.Add(bCyclic);
+			Stack.SetNum(First, false);
+		}
+	}
+}
@@ -0,0 +1,352 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptJournal.h"
+#include "ConceptSaveArchive.h"
+#include "ConceptRegistry.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+void FConceptJournalRecord::Write(FConceptSaveWriter& Writer) const
+{
+	Writer.WritePacked(Sequence);
+	Writer.WriteInt64(Timestamp);
+	Writer.WriteByte(static_cast<uint8>(Op));
+
+	switch (Op)
+	{
+	case EConceptJournalOp::Acquire:
+		Writer.WritePacked(static_cast<uint32>(SlotIndex));
+		Writer.WriteConcept(Concepts.Num() > 0 ? Concepts[0] : nullptr);
+		Writer.WriteByte(static_cast<uint8>(BodyPart));
+		break;
+	case EConceptJournalOp::MasteryDelta:
+		Writer.WritePacked(static_cast<uint32>(SlotIndex));
+		Writer.WriteByte(static_cast<uint8>(FMath::Clamp(Amount, -128, 127) + 128));
+		break;
+	case EConceptJournalOp::SlotReconfigure:
+		Writer.WritePacked(static_cast<uint32>(SlotIndex));
+		Writer.WriteByte(static_cast<uint8>(BodyPart));
+		Writer.WriteByte(static_cast<uint8>(Tier));
+		break;
+	case EConceptJournalOp::Unlock:
+		Writer.WritePacked(static_cast<uint32>(SlotIndex));
+		Writer.WriteByte(static_cast<uint8>(Tier));
+		Writer.WriteFloat(Value);
+		break;
+	case EConceptJournalOp::Mediate:
+		Writer.WriteByte(bFlag ? 1 : 0);
+		Writer.WritePacked(Concepts.Num());
+		for (const TSoftObjectPtr<UConcept>& Concept : Concepts)
+		{
+			Writer.WriteConcept(Concept);
+		}
+		break;
+	case EConceptJournalOp::Forge:
+		Writer.WriteConcept(Concepts.Num() > 0 ? Concepts[0] : nullptr);
+		Writer.WriteString(Target);
+		break;
+	case EConceptJournalOp::Observe:
+		Writer.WriteConcept(Concepts.Num() > 0 ? Concepts[0] : nullptr);
+		break;
+	case EConceptJournalOp::Progression:
+		Writer.WriteFloat(Value);
+		break;
+	case EConceptJournalOp::CoreNodeAmplification:
+		Writer.WriteByte(static_cast<uint8>(BodyPart));
+		Writer.WriteFloat(Value);
+		break;
+	}
+}
+
+void FConceptJournalRecord::Read(FConceptSaveReader& Reader)
+{
+	Sequence = Reader.ReadPacked();
+	Timestamp = Reader.ReadInt64();
+	Op = static_cast<EConceptJournalOp>(Reader.ReadByte());
+	Concepts.Reset();
+
+	switch (Op)
+	{
+	case EConceptJournalOp::Acquire:
+		SlotIndex = static_cast<int32>(Reader.ReadPacked());
+		Concepts.Add(Reader.ReadConcept());
+		BodyPart = static_cast<EBodyPartType>(Reader.ReadByte());
+		break;
+	case EConceptJournalOp::MasteryDelta:
+		SlotIndex = static_cast<int32>(Reader.ReadPacked());
+		Amount = static_cast<int32>(Reader.ReadByte()) - 128;
+		break;
+	case EConceptJournalOp::SlotReconfigure:
+		SlotIndex = static_cast<int32>(Reader.ReadPacked());
+		BodyPart = static_cast<EBodyPartType>(Reader.ReadByte());
+		Tier = static_cast<EConceptTier>(Reader.ReadByte());
+		break;
+	case EConceptJournalOp::Unlock:
+		SlotIndex = static_cast<int32>(Reader.ReadPacked());
+		Tier = static_cast<EConceptTier>(Reader.ReadByte());
+		Value = Reader.ReadFloat();
+		break;
+	case EConceptJournalOp::Mediate:
+	{
+		bFlag = Reader.ReadByte() != 0;
+		const uint32 Count = Reader.ReadPacked();
+		for (uint32 i = 0; i < Count && !Reader.IsError(); ++i)
+		{
+			Concepts.Add(Reader.ReadConcept());
+		}
+		break;
+	}
+	case EConceptJournalOp::Forge:
+		Concepts.Add(Reader.ReadConcept());
+		Target = Reader.ReadString();
+		break;
+	case EConceptJournalOp::Observe:
+		Concepts.Add(Reader.ReadConcept());
+		break;
+	case EConceptJournalOp::Progression:
+		Value = Reader.ReadFloat();
+		break;
+	case EConceptJournalOp::CoreNodeAmplification:
+		BodyPart = static_cast<EBodyPartType>(Reader.ReadByte());
+		Value = Reader.ReadFloat();
+		break;
+	}
+}
+
+FString FConceptJournalRecord::ToString() const
+{
+	static const TCHAR* OpNames[] = { TEXT("Acquire"), TEXT("MasteryDelta"), TEXT("SlotReconfigure"), TEXT("Unlock"), TEXT("Mediate"), TEXT("Forge"), TEXT("Observe"), TEXT("Progression"), TEXT("CoreNodeAmplification") };
+	const uint8 OpIndex = static_cast<uint8>(Op);
+
+	TArray<FString> ConceptNames;
+	for (const TSoftObjectPtr<UConcept>& Concept : Concepts)
+	{
+		ConceptNames.Add(Concept.IsNull() ? TEXT("None") : Concept.GetAssetName());
+	}
+
+	return FString::Printf(TEXT("#%u %s %s Slot:%d Concepts:[%s] Amount:%d Value:%.2f %s"),
+		Sequence,
+		*FDateTime(Timestamp).ToIso8601(),
+		OpIndex < UE_ARRAY_COUNT(OpNames) ? OpNames[OpIndex] : TEXT("Unknown"),
+		SlotIndex,
+		*FString::Join(ConceptNames, TEXT(", ")),
+		Amount,
+		Value,
+		*Target);
+}
+
+FConceptFileJournal::FConceptFileJournal(const FString& InDirectory, const FString& InKey, const UConceptRegistry* InRegistry, bool bInKeepAuditTrail)
+	: Directory(InDirectory)
+	, Key(FPaths::MakeValidFileName(InKey, TEXT('_')))
+	, Registry(InRegistry)
+	, bKeepAuditTrail(bInKeepAuditTrail)
+	, FileVersion(static_cast<uint16>(ConceptSaveFormat::EVersion::Latest))
+	, FileCatalogHash(InRegistry ? InRegistry->GetCatalogHash() : 0)
+{
+	// The key is only ever a file name; separators and other path characters are replaced
+	JournalPath = Directory / (Key + TEXT(".journal"));
+	SnapshotPath = Directory / (Key + TEXT(".snapshot"));
+}
+
+FConceptFileJournal::~FConceptFileJournal()
+{
+	Flush();
+}
+
+bool FConceptFileJournal::OpenForAppend()
+{
+	if (FileHandle)
+	{
+		return true;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*Directory);
+
+	const bool bIsNew = !PlatformFile.FileExists(*JournalPath) || PlatformFile.FileSize(*JournalPath) <= 0;
+
+	// Records are written at the latest version and against the current catalog, so they can't follow an older header
+	if (!bIsNew && NeedsCompaction())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ConceptFileJournal: %s is a version %d journal for catalog %08x; compact it before appending."), *JournalPath, FileVersion, FileCatalogHash);
+		return false;
+	}
+
+	FileHandle.Reset(PlatformFile.OpenWrite(*JournalPath, true));
+	if (!FileHandle)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ConceptFileJournal: Could not open %s for writing."), *JournalPath);
+		return false;
+	}
+
+	// New journals start with the same header as a save blob, so records can be validated against the catalog
+	if (bIsNew)
+	{
+		TArray<uint8> Header;
+		FConceptSaveWriter Writer(Header, Registry);
+		Writer.WriteHeader();
+		Writer.Finish();
+		FileHandle->Write(Header.GetData(), Header.Num());
+		FileVersion = static_cast<uint16>(ConceptSaveFormat::EVersion::Latest);
+		FileCatalogHash = Registry ? Registry->GetCatalogHash() : 0;
+		DefinedConcepts.Reset();
+	}
+
+	return true;
+}
+
+void FConceptFileJournal::Append(const FConceptJournalRecord& Record)
+{
+	if (!OpenForAppend())
+	{
+		return;
+	}
+
+	TArray<uint8> Payload;
+	FConceptSaveWriter Writer(Payload, Registry);
+	Record.Write(Writer);
+	Writer.Finish(&DefinedConcepts);
+
+	// Frame: payload size, payload CRC, payload. A torn final frame fails its CRC and is dropped on load.
+	uint32 Frame[2] = { static_cast<uint32>(Payload.Num()), FCrc::MemCrc32(Payload.GetData(), Payload.Num()) };
+	FileHandle->Write(reinterpret_cast<const uint8*>(Frame), sizeof(Frame));
+	FileHandle->Write(Payload.GetData(), Payload.Num());
+}
+
+void FConceptFileJournal::Flush()
+{
+	if (FileHandle)
+	{
+		FileHandle->Flush();
+	}
+}
+
+bool FConceptFileJournal::Load(TArray<uint8>& OutSnapshot, uint32& OutSnapshotSequence, TArray<FConceptJournalRecord>& OutRecords)
+{
+	OutSnapshot.Reset();
+	OutSnapshotSequence = 0;
+	OutRecords.Reset();
+
+	// A crash between Compact's delete and move leaves only the new snapshot, complete, under its temp name
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString TempPath = GetTempSnapshotPath();
+	if (!PlatformFile.FileExists(*SnapshotPath) && PlatformFile.FileExists(*TempPath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ConceptFileJournal: Recovering snapshot %s from an interrupted compaction."), *SnapshotPath);
+		PlatformFile.MoveFile(*SnapshotPath, *TempPath);
+	}
+
+	// Snapshot file: last covered sequence followed by a concept state blob
+	TArray<uint8> SnapshotFile;
+	const FString& LoadPath = PlatformFile.FileExists(*SnapshotPath) ? SnapshotPath : TempPath;
+	if (FFileHelper::LoadFileToArray(SnapshotFile, *LoadPath, FILEREAD_Silent) && SnapshotFile.Num() >= sizeof(uint32))
+	{
+		FMemory::Memcpy(&OutSnapshotSequence, SnapshotFile.GetData(), sizeof(uint32));
+		OutSnapshot.Append(SnapshotFile.GetData() + sizeof(uint32), SnapshotFile.Num() - sizeof(uint32));
+	}
+
+	// Make sure pending appends are visible before reading the journal back
+	Flush();
+
+	TArray<uint8> JournalFile;
+	if (!FFileHelper::LoadFileToArray(JournalFile, *JournalPath, FILEREAD_Silent))
+	{
+		return true; // No records since the snapshot
+	}
+
+	// Records only define the concepts earlier records didn't, so every reader of the file shares one remap
+	FConceptSaveRemap Remap;
+	Remap.bTrackDefined = true;
+
+	FConceptSaveReader HeaderReader(JournalFile, Registry);
+	HeaderReader.SetRemap(Remap);
+	if (!HeaderReader.ReadHeader())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ConceptFileJournal: %s was written against a different catalog and cannot be replayed."), *JournalPath);
+		return false;
+	}
+
+	FileVersion = HeaderReader.GetVersion();
+	FileCatalogHash = HeaderReader.GetCatalogHash();
+
+	int64 Offset = HeaderReader.Tell();
+	while (Offset + static_cast<int64>(sizeof(uint32) * 2) <= JournalFile.Num())
+	{
+		uint32 Frame[2];
+		FMemory::Memcpy(Frame, JournalFile.GetData() + Offset, sizeof(Frame));
+		Offset += sizeof(Frame);
+
+		const int64 PayloadSize = Frame[0];
+		if (Offset + PayloadSize > JournalFile.Num() || FCrc::MemCrc32(JournalFile.GetData() + Offset, PayloadSize) != Frame[1])
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ConceptFileJournal: Dropping torn record at offset %lld in %s."), Offset - static_cast<int64>(sizeof(Frame)), *JournalPath);
+			break;
+		}
+
+		FConceptSaveReader Reader(TArrayView<const uint8>(JournalFile.GetData() + Offset, PayloadSize), Registry);
+		Reader.SetRemap(Remap);
+		FConceptJournalRecord Record;
+		if (Reader.ReadPayloadHeader(FileVersion))
+		{
+			Record.Read(Reader);
+		}
+		Offset += PayloadSize;
+
+		// Records already folded into the snapshot are only kept for auditing
+		if (!Reader.IsError() && Record.Sequence > OutSnapshotSequence)
+		{
+			OutRecords.Add(MoveTemp(Record));
+		}
+	}
+
+	DefinedConcepts = MoveTemp(Remap.Defined);
+	return true;
+}
+
+bool FConceptFileJournal::NeedsCompaction() const
+{
+	return FileVersion < static_cast<uint16>(ConceptSaveFormat::EVersion::Latest)
+		|| (Registry && FileCatalogHash != Registry->GetCatalogHash());
+}
+
+bool FConceptFileJournal::Compact(const TArray<uint8>& Snapshot, uint32 LastSequence)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*Directory);
+
+	// Write the snapshot next to the old one and swap. The temp file is complete before the old snapshot is deleted,
+	// so a crash in between leaves it for Load to recover, and a crash while writing it leaves the old snapshot intact.
+	TArray<uint8> SnapshotFile;
+	SnapshotFile.Reserve(sizeof(uint32) + Snapshot.Num());
+	SnapshotFile.Append(reinterpret_cast<const uint8*>(&LastSequence), sizeof(uint32));
+	SnapshotFile.Append(Snapshot);
+
+	const FString TempPath = GetTempSnapshotPath();
+	if (!FFileHelper::SaveArrayToFile(SnapshotFile, *TempPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ConceptFileJournal: Could not write snapshot %s."), *TempPath);
+		return false;
+	}
+
+	PlatformFile.DeleteFile(*SnapshotPath);
+	if (!PlatformFile.MoveFile(*SnapshotPath, *TempPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ConceptFileJournal: Could not replace snapshot %s."), *SnapshotPath);
+		return false;
+	}
+
+	// Retire the records the snapshot now covers
+	FileHandle.Reset();
+	if (bKeepAuditTrail)
+	{
+		const FString AuditPath = Directory / FString::Printf(TEXT("%s.%u.audit"), *Key, LastSequence);
+		PlatformFile.MoveFile(*AuditPath, *JournalPath);
+	}
+	else
+	{
+		PlatformFile.DeleteFile(*JournalPath);
+	}
+
+	return OpenForAppend();
+}
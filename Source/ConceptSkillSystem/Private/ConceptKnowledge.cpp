@@ -0,0 +1,121 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptKnowledge.h"
+#include "ConceptComponent.h"
+
+FConceptKnowledgeEntry::FConceptKnowledgeEntry()
+{
+	bObserved = false;
+	bAcquired = false;
+}
+
+void FConceptKnowledgeEntry::PreReplicatedRemove(const FConceptKnowledgeContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleReplicatedKnowledgeRemoved(*this);
+	}
+}
+
+void FConceptKnowledgeEntry::PostReplicatedAdd(const FConceptKnowledgeContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleReplicatedKnowledgeChanged(*this);
+	}
+}
+
+void FConceptKnowledgeEntry::PostReplicatedChange(const FConceptKnowledgeContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleReplicatedKnowledgeChanged(*this);
+	}
+}
+
+void FConceptKnowledgeContainer::MarkObserved(UConcept* Concept)
+{
+	if (!Concept)
+	{
+		return;
+	}
+
+	FConceptKnowledgeEntry& Entry = FindOrAdd(Concept);
+	if (!Entry.bObserved)
+	{
+		Entry.bObserved = true;
+		MarkEntryDirty(Entry);
+	}
+}
+
+void FConceptKnowledgeContainer::MarkAcquired(UConcept* Concept)
+{
+	if (!Concept)
+	{
+		return;
+	}
+
+	FConceptKnowledgeEntry& Entry = FindOrAdd(Concept);
+	if (!Entry.bAcquired)
+	{
+		Entry.bAcquired = true;
+		MarkEntryDirty(Entry);
+	}
+}
+
+void FConceptKnowledgeContainer::ClearObserved(UConcept* Concept)
+{
+	FConceptKnowledgeEntry* Entry = Items.FindByPredicate([Concept](const FConceptKnowledgeEntry& Item) { return Item.Concept.Get() == Concept; });
+	if (Entry && Entry->bObserved)
+	{
+		Entry->bObserved = false;
+		MarkEntryDirty(*Entry);
+	}
+}
+
+void FConceptKnowledgeContainer::ClearAcquired(UConcept* Concept)
+{
+	FConceptKnowledgeEntry* Entry = Items.FindByPredicate([Concept](const FConceptKnowledgeEntry& Item) { return Item.Concept.Get() == Concept; });
+	if (Entry && Entry->bAcquired)
+	{
+		Entry->bAcquired = false;
+		MarkEntryDirty(*Entry);
+	}
+}
+
+void FConceptKnowledgeContainer::MarkEntryDirty(FConceptKnowledgeEntry& Entry)
+{
+	if (!Owner || !Owner->IsPreviewing())
+	{
+		MarkItemDirty(Entry);
+	}
+}
+
+void FConceptKnowledgeContainer::Reset()
+{
+	Items.Reset();
+	MarkArrayDirty();
+}
+
+FConceptKnowledgeEntry& FConceptKnowledgeContainer::FindOrAdd(UConcept* Concept)
+{
+	if (FConceptKnowledgeEntry* Existing = Items.FindByPredicate([Concept](const FConceptKnowledgeEntry& Entry) { return Entry.Concept.Get() == Concept; }))
+	{
+		return *Existing;
+	}
+
+	FConceptKnowledgeEntry& NewEntry = Items.AddDefaulted_GetRef();
+	NewEntry.Concept = Concept;
+	return NewEntry;
+}
+
+int32 FConceptPublicSummary::GetTierCount(EConceptTier Tier) const
+{
+	const int32 Index = static_cast<int32>(Tier);
+	return TierCounts.IsValidIndex(Index) ? TierCounts[Index] : 0;
+}
+
+bool FConceptPublicSummary::operator==(const FConceptPublicSummary& Other) const
+{
+	return VisibleTags == Other.VisibleTags && TierCounts == Other.TierCounts && PublicSynergies == Other.PublicSynergies;
+}
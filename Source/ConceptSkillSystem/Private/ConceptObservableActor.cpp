@@ -2,41 +2,96 @@
 
 #include "ConceptObservableActor.h"
 #include "ConceptComponent.h"
+#include "ConceptObservationSubsystem.h"
+#include "Engine/AssetManager.h"
 
 AConceptObservableActor::AConceptObservableActor()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Cooldowns expire on the observation subsystem's timing wheel, so nothing here needs to tick
+	PrimaryActorTick.bCanEverTick = false;
 
 	BaseObservationQuality = 0.5f;
 	bCanBeObserved = true;
 	ObservationCooldown = 60.0f; // 1 minute cooldown by default
-	LastObservedTime = -ObservationCooldown; // Allow immediate observation when game starts
+	ObservationSubsystem = nullptr;
 }
 
 void AConceptObservableActor::BeginPlay()
 {
 	Super::BeginPlay();
+
+	RefreshObservableConcepts();
+
+	// Observers find this actor through the observation subsystem's spatial hash
+	ObservationSubsystem = UConceptObservationSubsystem::Get(this);
+	if (ObservationSubsystem)
+	{
+		ObservationSubsystem->RegisterObservable(this);
+	}
 }
 
-void AConceptObservableActor::Tick(float DeltaTime)
+void AConceptObservableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	if (ObservationSubsystem)
+	{
+		ObservationSubsystem->UnregisterObservable(this);
+		ObservationSubsystem = nullptr;
+	}
+
+	if (ConceptLoadHandle.IsValid())
+	{
+		ConceptLoadHandle->CancelHandle();
+		ConceptLoadHandle.Reset();
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
-TArray<UConcept*> AConceptObservableActor::GetObservableConcepts_Implementation() const
+void AConceptObservableActor::RefreshObservableConcepts()
 {
-	TArray<UConcept*> Concepts;
+	if (ConceptLoadHandle.IsValid())
+	{
+		ConceptLoadHandle->CancelHandle();
+		ConceptLoadHandle.Reset();
+	}
 
-	// Convert soft pointers to regular pointers
-	for (const auto& ConceptPtr : ObservableConcepts)
+	TArray<FSoftObjectPath> PendingPaths;
+	for (const TSoftObjectPtr<UConcept>& ConceptPtr : ObservableConcepts)
+	{
+		if (!ConceptPtr.IsNull() && !ConceptPtr.Get())
+		{
+			PendingPaths.Add(ConceptPtr.ToSoftObjectPath());
+		}
+	}
+
+	// Resolve now what is already loaded; the rest joins when the load completes
+	ResolveConcepts();
+
+	if (PendingPaths.Num() > 0)
+	{
+		ConceptLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			PendingPaths, FStreamableDelegate::CreateUObject(this, &AConceptObservableActor::ResolveConcepts));
+	}
+}
+
+void AConceptObservableActor::ResolveConcepts()
+{
+	ResolvedConcepts.Reset(ObservableConcepts.Num());
+	AcquisitionDifficulties.Reset(ObservableConcepts.Num());
+
+	for (const TSoftObjectPtr<UConcept>& ConceptPtr : ObservableConcepts)
 	{
 		if (UConcept* Concept = ConceptPtr.Get())
 		{
-			Concepts.Add(Concept);
+			ResolvedConcepts.Add(Concept);
+			AcquisitionDifficulties.Add(static_cast<float>(FMath::Max(Concept->AcquisitionDifficulty, 1)));
 		}
 	}
+}
 
-	return Concepts;
+TArray<UConcept*> AConceptObservableActor::GetObservableConcepts_Implementation() const
+{
+	return ResolvedConcepts;
 }
 
 float AConceptObservableActor::GetObservationQuality_Implementation() const
@@ -46,8 +101,11 @@ float AConceptObservableActor::GetObservationQuality_Implementation() const
 
 void AConceptObservableActor::OnObserved_Implementation(AActor* Observer)
 {
-	// Update last observed time
-	LastObservedTime = GetWorld()->GetTimeSeconds();
+	// Only this observer has to wait; everyone else can still observe
+	if (ObservationSubsystem)
+	{
+		ObservationSubsystem->StartObservationCooldown(Observer, this, ObservationCooldown);
+	}
 
 	// Try to find a concept component on the observer
 	if (Observer)
@@ -55,10 +113,21 @@ void AConceptObservableActor::OnObserved_Implementation(AActor* Observer)
 		UConceptComponent* ConceptComp = Observer->FindComponentByClass<UConceptComponent>();
 		if (ConceptComp)
 		{
-			// Let the observer's concept component observe each concept
-			for (UConcept* Concept : GetObservableConcepts_Implementation())
+			// Let the observer's concept component observe each concept, through any Blueprint overrides
+			const float Quality = IConceptObservable::Execute_GetObservationQuality(this);
+			if (IsNativeImplementation(GET_FUNCTION_NAME_CHECKED(IConceptObservable, GetObservableConcepts)))
+			{
+				for (UConcept* Concept : ResolvedConcepts)
+				{
+					ConceptComp->ObserveConcept(Concept, Quality);
+				}
+			}
+			else
 			{
-				ConceptComp->ObserveConcept(Concept, GetObservationQuality_Implementation());
+				for (UConcept* Concept : IConceptObservable::Execute_GetObservableConcepts(this))
+				{
+					ConceptComp->ObserveConcept(Concept, Quality);
+				}
 			}
 		}
 	}
@@ -69,11 +138,18 @@ void AConceptObservableActor::OnObserved_Implementation(AActor* Observer)
 
 bool AConceptObservableActor::CanBeObserved_Implementation() const
 {
-	return bCanBeObserved && HasObservationCooldownElapsed();
+	// Cooldowns are per observer; see HasObservationCooldownElapsed
+	return bCanBeObserved;
+}
+
+bool AConceptObservableActor::HasObservationCooldownElapsed(const AActor* Observer) const
+{
+	return !ObservationSubsystem || !ObservationSubsystem->IsObservationOnCooldown(Observer, this);
 }
 
-bool AConceptObservableActor::HasObservationCooldownElapsed() const
+bool AConceptObservableActor::IsNativeImplementation(FName FunctionName) const
 {
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-	return (CurrentTime - LastObservedTime) >= ObservationCooldown;
+	// A Blueprint override adds a script function that shadows the native event
+	const UFunction* Function = FindFunction(FunctionName);
+	return !Function || Function->HasAnyFunctionFlags(FUNC_Native);
 }
@@ -0,0 +1,160 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptObservationSessions.h"
+#include "ConceptComponent.h"
+#include "Concept.h"
+
+FConceptObservationSessions::FConceptObservationSessions()
+{
+	Cursor = 0;
+}
+
+uint64 FConceptObservationSessions::MakeKey(const UConceptComponent* Observer, const UConcept* Concept)
+{
+	return (static_cast<uint64>(Observer->GetUniqueID()) << 32) | Concept->GetUniqueID();
+}
+
+void FConceptObservationSessions::Touch(UConceptComponent* Observer, UConcept* Concept, AActor* Observable, float Rate, float Quality, float InViewTime, double Now)
+{
+	if (!Observer || !Concept)
+	{
+		return;
+	}
+
+	const uint64 Key = MakeKey(Observer, Concept);
+	int32 Index = INDEX_NONE;
+	if (const int32* Existing = IndexByKey.Find(Key))
+	{
+		Index = *Existing;
+		PendingTime[Index] += InViewTime;
+	}
+	else
+	{
+		Index = Progress.Num();
+		Keys.Add(Key);
+		Observers.Add(Observer);
+		Concepts.Add(Concept);
+		Observables.Add(Observable);
+		Progress.Add(0.0f);
+		Rates.Add(0.0f);
+		PendingTime.Add(0.0f); // Study starts from the first full frame in view
+		Qualities.Add(0.0f);
+		LastSeenTimes.Add(Now);
+		IndexByKey.Add(Key, Index);
+	}
+
+	// Rate and quality follow the observer's current attributes and the best view this frame
+	Observables[Index] = Observable;
+	Rates[Index] = Rate;
+	Qualities[Index] = LastSeenTimes[Index] == Now ? FMath::Max(Qualities[Index], Quality) : Quality;
+	LastSeenTimes[Index] = Now;
+}
+
+void FConceptObservationSessions::Advance(double Now, double BudgetSeconds, float ForgetTime, TArray<FConceptObservationCompletion>& OutCompleted)
+{
+	const int32 Count = Progress.Num();
+	if (Count == 0)
+	{
+		return;
+	}
+
+	const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+	Cursor = Cursor < Count ? Cursor : 0;
+
+	// Visit each session at most once; removals swap a later session into the current index
+	int32 Remaining = Count;
+	while (Remaining-- > 0 && Progress.Num() > 0)
+	{
+		const int32 Index = Cursor;
+
+		bool bRemove = false;
+		if (PendingTime[Index] > 0.0f)
+		{
+			Progress[Index] += PendingTime[Index] * Rates[Index];
+			PendingTime[Index] = 0.0f;
+
+			if (Progress[Index] >= 1.0f)
+			{
+				UConceptComponent* Observer = Observers[Index].Get();
+				UConcept* Concept = Concepts[Index].Get();
+				if (Observer && Concept)
+				{
+					OutCompleted.Add({ Observer, Concept, Qualities[Index], Observables[Index].Get() });
+				}
+				bRemove = true;
+			}
+		}
+		else if (Now - LastSeenTimes[Index] > ForgetTime)
+		{
+			// Out of view long enough to lose the thread
+			bRemove = true;
+		}
+
+		if (bRemove)
+		{
+			RemoveAtSwap(Index);
+		}
+		else
+		{
+			++Cursor;
+		}
+
+		if (Cursor >= Progress.Num())
+		{
+			Cursor = 0;
+		}
+
+		// Checking the clock is not free, so only do it every few sessions
+		if ((Remaining & 63) == 0 && FPlatformTime::Seconds() > Deadline)
+		{
+			break;
+		}
+	}
+}
+
+float FConceptObservationSessions::GetProgress(const UConceptComponent* Observer, const UConcept* Concept) const
+{
+	if (!Observer || !Concept)
+	{
+		return 0.0f;
+	}
+
+	const int32* Index = IndexByKey.Find(MakeKey(Observer, Concept));
+	return Index ? FMath::Min(Progress[*Index], 1.0f) : 0.0f;
+}
+
+void FConceptObservationSessions::Reset()
+{
+	Keys.Reset();
+	Observers.Reset();
+	Concepts.Reset();
+	Observables.Reset();
+	Progress.Reset();
+	Rates.Reset();
+	PendingTime.Reset();
+	Qualities.Reset();
+	LastSeenTimes.Reset();
+	IndexByKey.Reset();
+	Cursor = 0;
+}
+
+void FConceptObservationSessions::RemoveAtSwap(int32 Index)
+{
+	IndexByKey.Remove(Keys[Index]);
+
+	const int32 LastIndex = Progress.Num() - 1;
+	if (Index != LastIndex)
+	{
+		IndexByKey.Add(Keys[LastIndex], Index);
+	}
+
+	Keys.RemoveAtSwap(Index, 1, false);
+	Observers.RemoveAtSwap(Index, 1, false);
+	Concepts.RemoveAtSwap(Index, 1, false);
+	Observables.RemoveAtSwap(Index, 1, false);
+	Progress.RemoveAtSwap(Index, 1, false);
+	Rates.RemoveAtSwap(Index, 1, false);
+	PendingTime.RemoveAtSwap(Index, 1, false);
+	Qualities.RemoveAtSwap(Index, 1, false);
+	LastSeenTimes.RemoveAtSwap(Index, 1, false);
+}
@@ -0,0 +1,442 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptObservationSubsystem.h"
+#include "ConceptObservable.h"
+#include "ConceptObservableActor.h"
+#include "Concept.h"
+#include "ConceptComponent.h"
+#include "AbilitySystemComponent.h"
+#include "Abilities/ConceptAttributeSet.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+
+UConceptObservationSubsystem::UConceptObservationSubsystem()
+{
+	CellSize = 1000.0f;
+	DefaultObservationRange = 500.0f;
+	MaxCanBeObservedPolls = 64;
+	NextCanBeObservedPoll = 0;
+	bContinuousObservation = false;
+	StudySecondsPerDifficulty = 0.25f;
+	SessionForgetTime = 3.0f;
+	SessionCompleteCooldown = 60.0f;
+	NextCreditObserver = 0;
+}
+
+void UConceptObservationSubsystem::Deinitialize()
+{
+	Observables.Empty();
+	FreeObservableIndices.Empty();
+	ObservableIndexByActor.Empty();
+	Cells.Empty();
+	Observers.Empty();
+	Queries.Empty();
+	Results.Empty();
+	ObservationCooldowns.Reset();
+	Sessions.Reset();
+	CompletedSessions.Empty();
+
+	Super::Deinitialize();
+}
+
+void UConceptObservationSubsystem::Update(float DeltaTime, double BudgetSeconds)
+{
+	// Expire cooldowns before the query so observables come back into range on time
+	ObservationCooldowns.Advance(DeltaTime);
+
+	UpdateObservation();
+
+	if (bContinuousObservation)
+	{
+		UpdateSessions(DeltaTime, BudgetSeconds);
+	}
+}
+
+UConceptObservationSubsystem* UConceptObservationSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UConceptObservationSubsystem>() : nullptr;
+}
+
+FIntVector UConceptObservationSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UConceptObservationSubsystem::RegisterObservable(AActor* Observable)
+{
+	if (!Observable || !Observable->GetClass()->ImplementsInterface(UConceptObservable::StaticClass()) || ObservableIndexByActor.Contains(Observable))
+	{
+		return;
+	}
+
+	const int32 Index = FreeObservableIndices.Num() > 0 ? FreeObservableIndices.Pop(false) : Observables.AddDefaulted();
+
+	FObservableEntry& Entry = Observables[Index];
+	Entry.Actor = Observable;
+	Entry.ObservableId = Observable->GetUniqueID();
+	Entry.Location = Observable->GetActorLocation();
+	Entry.Cell = GetCell(Entry.Location);
+
+	const AConceptObservableActor* ObservableActor = Cast<AConceptObservableActor>(Observable);
+	Entry.bNativeCanBeObserved = ObservableActor && ObservableActor->IsNativeImplementation(GET_FUNCTION_NAME_CHECKED(IConceptObservable, CanBeObserved));
+	Entry.bNativeConcepts = ObservableActor && ObservableActor->IsNativeImplementation(GET_FUNCTION_NAME_CHECKED(IConceptObservable, GetObservableConcepts));
+	Entry.bCanBeObserved = IConceptObservable::Execute_CanBeObserved(Observable);
+
+	Cells.FindOrAdd(Entry.Cell).Add(Index);
+	ObservableIndexByActor.Add(Observable, Index);
+}
+
+void UConceptObservationSubsystem::UnregisterObservable(AActor* Observable)
+{
+	int32 Index = INDEX_NONE;
+	if (!ObservableIndexByActor.RemoveAndCopyValue(Observable, Index))
+	{
+		return;
+	}
+
+	RemoveFromCell(Index);
+	Observables[Index] = FObservableEntry();
+	FreeObservableIndices.Add(Index);
+}
+
+void UConceptObservationSubsystem::RemoveFromCell(int32 ObservableIndex)
+{
+	const FIntVector Cell = Observables[ObservableIndex].Cell;
+	if (TArray<int32>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveSingleSwap(ObservableIndex, false);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UConceptObservationSubsystem::RegisterObserver(UConceptComponent* Observer)
+{
+	if (Observer && !Observers.Contains(Observer))
+	{
+		Observers.Add(Observer);
+		Queries.AddDefaulted();
+		Results.AddDefaulted();
+	}
+}
+
+void UConceptObservationSubsystem::UnregisterObserver(UConceptComponent* Observer)
+{
+	const int32 Index = Observers.IndexOfByKey(Observer);
+	if (Index != INDEX_NONE)
+	{
+		Observers.RemoveAtSwap(Index);
+		Queries.RemoveAtSwap(Index);
+		Results.RemoveAtSwap(Index);
+	}
+}
+
+TArray<AActor*> UConceptObservationSubsystem::GetObservablesInRange(UConceptComponent* Observer) const
+{
+	TArray<AActor*> InRange;
+
+	const int32 ObserverIndex = Observers.IndexOfByKey(Observer);
+	if (ObserverIndex == INDEX_NONE)
+	{
+		return InRange;
+	}
+
+	for (int32 ObservableIndex : Results[ObserverIndex])
+	{
+		if (AActor* Observable = Observables[ObservableIndex].Actor.Get())
+		{
+			InRange.Add(Observable);
+		}
+	}
+
+	return InRange;
+}
+
+void UConceptObservationSubsystem::StartObservationCooldown(const AActor* Observer, const AActor* Observable, float Duration)
+{
+	if (Observer && Observable && Duration > 0.0f)
+	{
+		ObservationCooldowns.Add(FConceptCooldownWheel::MakeKey(Observer->GetUniqueID(), Observable->GetUniqueID()), Duration);
+	}
+}
+
+bool UConceptObservationSubsystem::IsObservationOnCooldown(const AActor* Observer, const AActor* Observable) const
+{
+	return Observer && Observable && ObservationCooldowns.IsActive(FConceptCooldownWheel::MakeKey(Observer->GetUniqueID(), Observable->GetUniqueID()));
+}
+
+float UConceptObservationSubsystem::GetObservationCooldownRemaining(const AActor* Observer, const AActor* Observable) const
+{
+	if (!Observer || !Observable)
+	{
+		return 0.0f;
+	}
+
+	return ObservationCooldowns.GetRemaining(FConceptCooldownWheel::MakeKey(Observer->GetUniqueID(), Observable->GetUniqueID()));
+}
+
+void UConceptObservationSubsystem::RefreshObservables()
+{
+	for (int32 Index = 0; Index < Observables.Num(); ++Index)
+	{
+		FObservableEntry& Entry = Observables[Index];
+		if (Entry.Actor.IsExplicitlyNull())
+		{
+			continue; // Free slot
+		}
+
+		AActor* Observable = Entry.Actor.Get();
+		if (!Observable)
+		{
+			// Destroyed without unregistering
+			RemoveFromCell(Index);
+			ObservableIndexByActor.Remove(Entry.Actor);
+			Entry = FObservableEntry();
+			FreeObservableIndices.Add(Index);
+			continue;
+		}
+
+		// Static observables never change cells
+		if (!Observable->IsRootComponentStatic())
+		{
+			Entry.Location = Observable->GetActorLocation();
+			const FIntVector NewCell = GetCell(Entry.Location);
+			if (NewCell != Entry.Cell)
+			{
+				RemoveFromCell(Index);
+				Entry.Cell = NewCell;
+				Cells.FindOrAdd(NewCell).Add(Index);
+			}
+		}
+
+		if (Entry.bNativeCanBeObserved)
+		{
+			Entry.bCanBeObserved = static_cast<const AConceptObservableActor*>(Observable)->bCanBeObserved;
+		}
+	}
+
+	// The rest answer through the interface, which can reach Blueprint, so they are polled a slice per update
+	const int32 NumEntries = Observables.Num();
+	int32 PollsLeft = MaxCanBeObservedPolls > 0 ? MaxCanBeObservedPolls : NumEntries;
+	for (int32 Visited = 0; Visited < NumEntries && PollsLeft > 0; ++Visited)
+	{
+		if (NextCanBeObservedPoll >= NumEntries)
+		{
+			NextCanBeObservedPoll = 0;
+		}
+
+		FObservableEntry& Entry = Observables[NextCanBeObservedPoll++];
+		AActor* Observable = Entry.Actor.Get();
+		if (Observable && !Entry.bNativeCanBeObserved)
+		{
+			Entry.bCanBeObserved = IConceptObservable::Execute_CanBeObserved(Observable);
+			--PollsLeft;
+		}
+	}
+}
+
+void UConceptObservationSubsystem::GatherObserverQueries()
+{
+	for (int32 Index = Observers.Num() - 1; Index >= 0; --Index)
+	{
+		UConceptComponent* Observer = Observers[Index].Get();
+		AActor* ObserverActor = Observer ? Observer->GetOwner() : nullptr;
+		if (!ObserverActor)
+		{
+			Observers.RemoveAtSwap(Index);
+			Queries.RemoveAtSwap(Index);
+			Results.RemoveAtSwap(Index);
+			continue;
+		}
+
+		FObserverQuery& Query = Queries[Index];
+		Query.ObserverId = ObserverActor->GetUniqueID();
+		Query.Location = ObserverActor->GetActorLocation();
+		Query.Range = DefaultObservationRange;
+		Query.Speed = 1.0f;
+
+		// ObservationRange drives the query and ObservationSpeed the study rate when the observer has the attributes
+		const UAbilitySystemComponent* ASC = Observer->GetAbilitySystemComponent();
+		if (ASC && ASC->HasAttributeSetForAttribute(UConceptAttributeSet::GetObservationRangeAttribute()))
+		{
+			Query.Range = ASC->GetNumericAttribute(UConceptAttributeSet::GetObservationRangeAttribute());
+			Query.Speed = ASC->GetNumericAttribute(UConceptAttributeSet::GetObservationSpeedAttribute());
+		}
+	}
+}
+
+void UConceptObservationSubsystem::UpdateObservation()
+{
+	RefreshObservables();
+	GatherObserverQueries();
+
+	// Each observer only writes its own result array and reads the hash and cooldowns, so observers run independently
+	ParallelFor(Observers.Num(), [this](int32 ObserverIndex)
+	{
+		QueryObservables(Queries[ObserverIndex], Results[ObserverIndex]);
+	});
+
+	OnObservationQueryComplete.Broadcast(this);
+}
+
+void UConceptObservationSubsystem::QueryObservables(const FObserverQuery& Query, TArray<int32>& OutInRange) const
+{
+	OutInRange.Reset();
+
+	const float RangeSquared = FMath::Square(Query.Range);
+	const FVector MinCorner = Query.Location - FVector(Query.Range);
+	const FVector MaxCorner = Query.Location + FVector(Query.Range);
+
+	auto TestBucket = [&](const TArray<int32>& Bucket)
+	{
+		for (int32 ObservableIndex : Bucket)
+		{
+			const FObservableEntry& Entry = Observables[ObservableIndex];
+			if (Entry.bCanBeObserved
+				&& FVector::DistSquared(Entry.Location, Query.Location) <= RangeSquared
+				&& !ObservationCooldowns.IsActive(FConceptCooldownWheel::MakeKey(Query.ObserverId, Entry.ObservableId)))
+			{
+				OutInRange.Add(ObservableIndex);
+			}
+		}
+	};
+
+	// The range box spans (2 * Range / CellSize)^3 cells; once that is more than are occupied, walk the occupied ones instead
+	const FVector Span = (MaxCorner - MinCorner) / CellSize + FVector(2.0);
+	if (Span.X * Span.Y * Span.Z > static_cast<double>(Cells.Num()))
+	{
+		for (const TPair<FIntVector, TArray<int32>>& Cell : Cells)
+		{
+			const FVector CellMin = FVector(Cell.Key) * CellSize;
+			const FVector CellMax = CellMin + FVector(CellSize);
+			if (CellMax.X >= MinCorner.X && CellMin.X <= MaxCorner.X
+				&& CellMax.Y >= MinCorner.Y && CellMin.Y <= MaxCorner.Y
+				&& CellMax.Z >= MinCorner.Z && CellMin.Z <= MaxCorner.Z)
+			{
+				TestBucket(Cell.Value);
+			}
+		}
+		return;
+	}
+
+	const FIntVector MinCell = GetCell(MinCorner);
+	const FIntVector MaxCell = GetCell(MaxCorner);
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				if (const TArray<int32>* Bucket = Cells.Find(FIntVector(X, Y, Z)))
+				{
+					TestBucket(*Bucket);
+				}
+			}
+		}
+	}
+}
+
+void UConceptObservationSubsystem::UpdateSessions(float DeltaTime, double BudgetSeconds)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+
+	// Every observer falls this update's time behind; the ones reached below catch up on all of theirs
+	for (FObserverQuery& Query : Queries)
+	{
+		Query.UncreditedStudyTime += DeltaTime;
+	}
+
+	// Credit study time to every (observer, concept) pair in view, resuming with the observer the last update stopped at.
+	// At least one observer is credited per update, so a starved budget still makes progress.
+	const int32 NumObservers = Observers.Num();
+	for (int32 Visited = 0; Visited < NumObservers; ++Visited)
+	{
+		if (Visited > 0 && FPlatformTime::Seconds() > Deadline)
+		{
+			break;
+		}
+
+		if (NextCreditObserver >= NumObservers)
+		{
+			NextCreditObserver = 0;
+		}
+
+		const int32 ObserverIndex = NextCreditObserver++;
+		UConceptComponent* Observer = Observers[ObserverIndex].Get();
+		FObserverQuery& Query = Queries[ObserverIndex];
+		const float InViewTime = Query.UncreditedStudyTime;
+		Query.UncreditedStudyTime = 0.0f;
+		if (!Observer || Query.Speed <= 0.0f)
+		{
+			continue;
+		}
+
+		for (int32 ObservableIndex : Results[ObserverIndex])
+		{
+			const FObservableEntry& Entry = Observables[ObservableIndex];
+			AActor* Observable = Entry.Actor.Get();
+			if (!Observable)
+			{
+				continue;
+			}
+
+			const float Quality = IConceptObservable::Execute_GetObservationQuality(Observable);
+
+			// Observable actors keep their concepts and difficulties resolved, so no array is built per frame,
+			// unless a Blueprint overrides which concepts they offer
+			if (Entry.bNativeConcepts)
+			{
+				const AConceptObservableActor* ObservableActor = static_cast<const AConceptObservableActor*>(Observable);
+				const TConstArrayView<UConcept*> Concepts = ObservableActor->GetResolvedConcepts();
+				const TConstArrayView<float> Difficulties = ObservableActor->GetAcquisitionDifficulties();
+				for (int32 ConceptIndex = 0; ConceptIndex < Concepts.Num(); ++ConceptIndex)
+				{
+					if (!Observer->HasAcquiredConcept(Concepts[ConceptIndex]))
+					{
+						Sessions.Touch(Observer, Concepts[ConceptIndex], Observable, Query.Speed / (StudySecondsPerDifficulty * Difficulties[ConceptIndex]), Quality, InViewTime, Now);
+					}
+				}
+				continue;
+			}
+
+			for (UConcept* Concept : IConceptObservable::Execute_GetObservableConcepts(Observable))
+			{
+				if (!Concept || Observer->HasAcquiredConcept(Concept))
+				{
+					continue;
+				}
+
+				const float StudyTime = StudySecondsPerDifficulty * FMath::Max(Concept->AcquisitionDifficulty, 1);
+				Sessions.Touch(Observer, Concept, Observable, Query.Speed / StudyTime, Quality, InViewTime, Now);
+			}
+		}
+	}
+
+	CompletedSessions.Reset();
+	Sessions.Advance(Now, FMath::Max(Deadline - FPlatformTime::Seconds(), 0.0), SessionForgetTime, CompletedSessions);
+
+	// Full understanding counts as an observation, with its usual chance to acquire, and starts the same per-observer
+	// cooldown a one-shot observation would
+	for (const FConceptObservationCompletion& Completion : CompletedSessions)
+	{
+		Completion.Observer->ObserveConcept(Completion.Concept, Completion.Quality);
+
+		if (Completion.Observable)
+		{
+			const AConceptObservableActor* ObservableActor = Cast<AConceptObservableActor>(Completion.Observable);
+			StartObservationCooldown(Completion.Observer->GetOwner(), Completion.Observable, ObservableActor ? ObservableActor->ObservationCooldown : SessionCompleteCooldown);
+		}
+	}
+}
+
+float UConceptObservationSubsystem::GetObservationProgress(UConceptComponent* Observer, UConcept* Concept) const
+{
+	return Sessions.GetProgress(Observer, Concept);
+}
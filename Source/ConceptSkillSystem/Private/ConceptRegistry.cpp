@@ -1,88 +1,122 @@
 // Copyright Koorogi Games, Inc. All Rights Reserved.
 
 #include "ConceptRegistry.h"
+#include "ConceptGraph.h"
 #include "Engine/AssetManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/Texture2D.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice ConceptMemReportCommand(
+	TEXT("ConceptSkill.MemReport"),
+	TEXT("Resident bytes per loaded concept and skill on a client, and with server-stripped data removed"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (UConceptRegistry* Registry = UConceptRegistry::GetConceptRegistry(World))
+		{
+			Registry->DumpMemoryReport(Ar);
+		}
+	}));
 
 void UConceptRegistry::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	// Load all concepts and skills when the subsystem initializes
-	LoadAllConcepts();
-	LoadAllSkills();
+	// The first game instance builds the catalog; later ones share it
+	FConceptCatalog::Get();
 }
 
 void UConceptRegistry::Deinitialize()
 {
+	// The catalog is shared, so it outlives this instance
 	Super::Deinitialize();
-
-	// Clear all data
-	AllConcepts.Empty();
-	AllSkills.Empty();
-	ConceptsByTier.Empty();
-	SkillsByType.Empty();
 }
 
 void UConceptRegistry::LoadAllConcepts()
 {
-	// Clear existing concepts
-	AllConcepts.Empty();
+	FConceptCatalog::Rebuild();
+}
 
-	// Use asset manager to find all concept assets
-	UAssetManager& AssetManager = UAssetManager::Get();
-	TArray<FAssetData> AssetData;
-	FARFilter Filter;
-	Filter.ClassNames.Add(UConcept::StaticClass()->GetFName());
-	Filter.bRecursiveClasses = true;
-	AssetManager.GetAssetRegistry().GetAssets(Filter, AssetData);
+void UConceptRegistry::LoadAllSkills()
+{
+	FConceptCatalog::Rebuild();
+}
 
-	// Add all found concepts to the array
-	for (const FAssetData& Asset : AssetData)
+void UConceptRegistry::RefreshCatalogAssets(const TArray<FSoftObjectPath>& ChangedAssets, const TArray<FSoftObjectPath>& RemovedAssets)
+{
+	FConceptCatalog::QueueRefresh(ChangedAssets, RemovedAssets);
+}
+
+TSharedPtr<FStreamableHandle> UConceptRegistry::RequestUIBundle(const TArray<FPrimaryAssetId>& AssetIds, FStreamableDelegate OnLoaded)
+{
+	if (IsRunningDedicatedServer())
 	{
-		TSoftObjectPtr<UConcept> ConceptPtr(Asset.GetAsset());
-		if (ConceptPtr.IsValid())
-		{
-			AllConcepts.Add(ConceptPtr);
-		}
+		return nullptr;
 	}
 
-	// Organize concepts by tier
-	OrganizeConceptsByTier();
+	return UAssetManager::Get().ChangeBundleStateForPrimaryAssets(AssetIds, { ConceptAssetBundles::UI }, {}, false, MoveTemp(OnLoaded));
 }
 
-void UConceptRegistry::LoadAllSkills()
+void UConceptRegistry::ReleaseUIBundle(const TArray<FPrimaryAssetId>& AssetIds)
 {
-	// Clear existing skills
-	AllSkills.Empty();
+	UAssetManager::Get().ChangeBundleStateForPrimaryAssets(AssetIds, {}, { ConceptAssetBundles::UI });
+}
+
+void UConceptRegistry::DumpMemoryReport(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Concept memory report (%s; client = as loaded plus loaded icons, server = without display data)"),
+		IsRunningDedicatedServer() ? TEXT("dedicated server") : TEXT("client"));
+
+	// Exclusive size counts the asset's own properties; icons are separate objects, so they are added explicitly
+	auto Report = [&Ar](const TCHAR* Label, const UObject* Asset, const TSoftObjectPtr<UTexture2D>& Icon, SIZE_T DisplayDataSize, SIZE_T& OutClientTotal, SIZE_T& OutServerTotal)
+	{
+		SIZE_T ClientSize = Asset->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		if (const UTexture2D* LoadedIcon = Icon.Get())
+		{
+			ClientSize += LoadedIcon->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		}
+		const SIZE_T ServerSize = ClientSize > DisplayDataSize ? ClientSize - DisplayDataSize : 0;
+
+		Ar.Logf(TEXT("  %s %-40s client %8llu B  server %8llu B"), Label, *Asset->GetName(), (uint64)ClientSize, (uint64)ServerSize);
+		OutClientTotal += ClientSize;
+		OutServerTotal += ServerSize;
+	};
 
-	// Use asset manager to find all skill assets
-	UAssetManager& AssetManager = UAssetManager::Get();
-	TArray<FAssetData> AssetData;
-	FARFilter Filter;
-	Filter.ClassNames.Add(UConceptSkill::StaticClass()->GetFName());
-	Filter.bRecursiveClasses = true;
-	AssetManager.GetAssetRegistry().GetAssets(Filter, AssetData);
+	SIZE_T ConceptClient = 0;
+	SIZE_T ConceptServer = 0;
+	int32 NumConcepts = 0;
+	for (const TSoftObjectPtr<UConcept>& ConceptPtr : GetCatalog().Concepts)
+	{
+		if (const UConcept* Concept = ConceptPtr.Get())
+		{
+			Report(TEXT("Concept"), Concept, Concept->Icon, Concept->GetDisplayDataSize(), ConceptClient, ConceptServer);
+			++NumConcepts;
+		}
+	}
 
-	// Add all found skills to the array
-	for (const FAssetData& Asset : AssetData)
+	SIZE_T SkillClient = 0;
+	SIZE_T SkillServer = 0;
+	int32 NumSkills = 0;
+	for (const TSoftObjectPtr<UConceptSkill>& SkillPtr : GetCatalog().Skills)
 	{
-		TSoftObjectPtr<UConceptSkill> SkillPtr(Asset.GetAsset());
-		if (SkillPtr.IsValid())
+		if (const UConceptSkill* Skill = SkillPtr.Get())
 		{
-			AllSkills.Add(SkillPtr);
+			Report(TEXT("Skill  "), Skill, Skill->Icon, Skill->GetDisplayDataSize(), SkillClient, SkillServer);
+			++NumSkills;
 		}
 	}
 
-	// Organize skills by manifestation type
-	OrganizeSkillsByType();
+	Ar.Logf(TEXT("Concepts: %d loaded, client %llu B (%llu B each), server %llu B (%llu B each)"),
+		NumConcepts, (uint64)ConceptClient, (uint64)(NumConcepts ? ConceptClient / NumConcepts : 0), (uint64)ConceptServer, (uint64)(NumConcepts ? ConceptServer / NumConcepts : 0));
+	Ar.Logf(TEXT("Skills: %d loaded, client %llu B (%llu B each), server %llu B (%llu B each)"),
+		NumSkills, (uint64)SkillClient, (uint64)(NumSkills ? SkillClient / NumSkills : 0), (uint64)SkillServer, (uint64)(NumSkills ? SkillServer / NumSkills : 0));
 }
 
 TArray<TSoftObjectPtr<UConcept>> UConceptRegistry::GetConceptsByTier(EConceptTier Tier) const
 {
-	if (ConceptsByTier.Contains(Tier))
+	if (const TArray<TSoftObjectPtr<UConcept>>* Concepts = GetCatalog().ConceptsByTier.Find(Tier))
 	{
-		return ConceptsByTier[Tier];
+		return *Concepts;
 	}
 
 	return TArray<TSoftObjectPtr<UConcept>>();
@@ -90,9 +124,9 @@ TArray<TSoftObjectPtr<UConcept>> UConceptRegistry::GetConceptsByTier(EConceptTie
 
 TArray<TSoftObjectPtr<UConceptSkill>> UConceptRegistry::GetSkillsByType(ESkillManifestationType Type) const
 {
-	if (SkillsByType.Contains(Type))
+	if (const TArray<TSoftObjectPtr<UConceptSkill>>* Skills = GetCatalog().SkillsByType.Find(Type))
 	{
-		return SkillsByType[Type];
+		return *Skills;
 	}
 
 	return TArray<TSoftObjectPtr<UConceptSkill>>();
@@ -100,7 +134,7 @@ TArray<TSoftObjectPtr<UConceptSkill>> UConceptRegistry::GetSkillsByType(ESkillMa
 
 UConcept* UConceptRegistry::FindConceptByName(const FString& ConceptName) const
 {
-	for (const auto& ConceptPtr : AllConcepts)
+	for (const auto& ConceptPtr : GetCatalog().Concepts)
 	{
 		UConcept* Concept = ConceptPtr.Get();
 		if (Concept && Concept->GetName().Equals(ConceptName, ESearchCase::IgnoreCase))
@@ -114,7 +148,7 @@ UConcept* UConceptRegistry::FindConceptByName(const FString& ConceptName) const
 
 UConceptSkill* UConceptRegistry::FindSkillByName(const FString& SkillName) const
 {
-	for (const auto& SkillPtr : AllSkills)
+	for (const auto& SkillPtr : GetCatalog().Skills)
 	{
 		UConceptSkill* Skill = SkillPtr.Get();
 		if (Skill && Skill->GetName().Equals(SkillName, ESearchCase::IgnoreCase))
@@ -135,7 +169,7 @@ TArray<TSoftObjectPtr<UConceptSkill>> UConceptRegistry::GetSkillsRequiringConcep
 		return MatchingSkills;
 	}
 
-	for (const auto& SkillPtr : AllSkills)
+	for (const auto& SkillPtr : GetCatalog().Skills)
 	{
 		UConceptSkill* Skill = SkillPtr.Get();
 		if (Skill)
@@ -154,62 +188,63 @@ TArray<TSoftObjectPtr<UConceptSkill>> UConceptRegistry::GetSkillsRequiringConcep
 	return MatchingSkills;
 }
 
-UConceptRegistry* UConceptRegistry::GetConceptRegistry(const UObject* WorldContextObject)
+TArray<UConcept*> UConceptRegistry::GetDiscoverableConcepts(UConcept* Concept, int32 MaxHops) const
 {
-	if (!WorldContextObject)
+	TArray<UConcept*> Discoverable;
+	if (!Concept)
 	{
-		return nullptr;
+		return Discoverable;
 	}
 
-	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
-	if (!GameInstance)
+	const FConceptCatalog& Catalog = GetCatalog();
+	TArray<int32> Indices;
+	FConceptGraph::BreadthFirst(Catalog, Catalog.GetConceptIndex(FSoftObjectPath(Concept)), MaxHops, Indices);
+
+	Discoverable.Reserve(Indices.Num());
+	for (const int32 Index : Indices)
 	{
-		return nullptr;
+		if (UConcept* Related = Catalog.Concepts[Index].Get())
+		{
+			Discoverable.Add(Related);
+		}
 	}
 
-	return GameInstance->GetSubsystem<UConceptRegistry>();
+	return Discoverable;
 }
 
-void UConceptRegistry::OrganizeConceptsByTier()
+bool UConceptRegistry::CanDiscoverTier(UConcept* Concept, EConceptTier Tier) const
 {
-	// Clear existing map
-	ConceptsByTier.Empty();
-
-	// Initialize arrays for each tier
-	ConceptsByTier.Add(EConceptTier::Physical, TArray<TSoftObjectPtr<UConcept>>());
-	ConceptsByTier.Add(EConceptTier::Intermediate, TArray<TSoftObjectPtr<UConcept>>());
-	ConceptsByTier.Add(EConceptTier::Advanced, TArray<TSoftObjectPtr<UConcept>>());
-	ConceptsByTier.Add(EConceptTier::Abstract, TArray<TSoftObjectPtr<UConcept>>());
-
-	// Categorize each concept by its tier
-	for (const auto& ConceptPtr : AllConcepts)
+	if (!Concept)
 	{
-		UConcept* Concept = ConceptPtr.Get();
-		if (Concept)
-		{
-			ConceptsByTier[Concept->Tier].Add(ConceptPtr);
-		}
+		return false;
 	}
+
+	const FConceptCatalog& Catalog = GetCatalog();
+	return FConceptGraph::CanReachTier(Catalog, Catalog.GetConceptIndex(FSoftObjectPath(Concept)), Tier);
 }
 
-void UConceptRegistry::OrganizeSkillsByType()
+int32 UConceptRegistry::GetConceptIndex(const TSoftObjectPtr<UConcept>& Concept) const
 {
-	// Clear existing map
-	SkillsByType.Empty();
+	return GetCatalog().GetConceptIndex(Concept.ToSoftObjectPath());
+}
 
-	// Initialize arrays for each type
-	SkillsByType.Add(ESkillManifestationType::Active, TArray<TSoftObjectPtr<UConceptSkill>>());
-	SkillsByType.Add(ESkillManifestationType::Passive, TArray<TSoftObjectPtr<UConceptSkill>>());
-	SkillsByType.Add(ESkillManifestationType::Crafting, TArray<TSoftObjectPtr<UConceptSkill>>());
-	SkillsByType.Add(ESkillManifestationType::Proficiency, TArray<TSoftObjectPtr<UConceptSkill>>());
+UConcept* UConceptRegistry::GetConceptByIndex(int32 Index) const
+{
+	return GetCatalog().Concepts.IsValidIndex(Index) ? GetCatalog().Concepts[Index].Get() : nullptr;
+}
 
-	// Categorize each skill by its manifestation type
-	for (const auto& SkillPtr : AllSkills)
+UConceptRegistry* UConceptRegistry::GetConceptRegistry(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
 	{
-		UConceptSkill* Skill = SkillPtr.Get();
-		if (Skill)
-		{
-			SkillsByType[Skill->ManifestationType].Add(SkillPtr);
-		}
+		return nullptr;
 	}
+
+	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+	if (!GameInstance)
+	{
+		return nullptr;
+	}
+
+	return GameInstance->GetSubsystem<UConceptRegistry>();
 }
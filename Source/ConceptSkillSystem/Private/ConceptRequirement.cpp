@@ -0,0 +1,456 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptRequirement.h"
+#include "ConceptComponent.h"
+#include "Concept.h"
+#include "Algo/AllOf.h"
+
+namespace ConceptRequirement
+{
+	// Nesting deeper than this is rejected, which also bounds the interpreter's recursion
+	static constexpr int32 MaxDepth = 32;
+
+	/**
+	 * FParser - Recursive descent over the expression text, emitting instructions as it goes
+	 * A group's instruction is only known once its first child has been parsed, so it is inserted in front of the
+	 * children; sizes are relative, so inserting never invalidates instructions already emitted.
+	 */
+	struct FParser
+	{
+		const TCHAR* Cursor;
+		TConstArrayView<TSoftObjectPtr<UConcept>> RequiredConcepts;
+		int32 DefaultMastery;
+
+		TArray<FConceptRequirementInstruction>& Code;
+		TArray<FSoftObjectPath>& Concepts;
+		TArray<FGameplayTag>& Tags;
+
+		FString Error;
+		int32 Depth = 0;
+
+		void SkipSpace()
+		{
+			while (FChar::IsWhitespace(*Cursor))
+			{
+				++Cursor;
+			}
+		}
+
+		// Consume a symbol if it comes next
+		bool Symbol(const TCHAR* Text)
+		{
+			SkipSpace();
+			const int32 Length = FCString::Strlen(Text);
+			if (FCString::Strncmp(Cursor, Text, Length) == 0)
+			{
+				Cursor += Length;
+				return true;
+			}
+			return false;
+		}
+
+		// Consume a keyword if it comes next as a whole word
+		bool Keyword(const TCHAR* Text)
+		{
+			SkipSpace();
+			const int32 Length = FCString::Strlen(Text);
+			if (FCString::Strnicmp(Cursor, Text, Length) == 0 && !FChar::IsAlnum(Cursor[Length]) && Cursor[Length] != TEXT('_'))
+			{
+				Cursor += Length;
+				return true;
+			}
+			return false;
+		}
+
+		bool Fail(const FString& Message)
+		{
+			if (Error.IsEmpty())
+			{
+				Error = FString::Printf(TEXT("%s at \"%s\""), *Message, Cursor);
+			}
+			return false;
+		}
+
+		bool ParseIdentifier(FString& OutIdentifier)
+		{
+			SkipSpace();
+			const TCHAR* Start = Cursor;
+			while (FChar::IsAlnum(*Cursor) || *Cursor == TEXT('_') || *Cursor == TEXT('.'))
+			{
+				++Cursor;
+			}
+
+			if (Cursor == Start || FChar::IsDigit(*Start))
+			{
+				Cursor = Start;
+				return Fail(TEXT("Expected a name"));
+			}
+
+			OutIdentifier = FString(static_cast<int32>(Cursor - Start), Start);
+			return true;
+		}
+
+		bool ParseNumber(int32& OutNumber)
+		{
+			SkipSpace();
+			if (!FChar::IsDigit(*Cursor))
+			{
+				return Fail(TEXT("Expected a number"));
+			}
+
+			OutNumber = 0;
+			while (FChar::IsDigit(*Cursor) && OutNumber <= MAX_uint16)
+			{
+				OutNumber = OutNumber * 10 + (*Cursor++ - TEXT('0'));
+			}
+			return OutNumber <= MAX_uint16 || Fail(TEXT("Number too large"));
+		}
+
+		bool Emit(EConceptRequirementOp Op, int32 Threshold, int32 Operand)
+		{
+			if (Code.Num() >= MAX_uint16)
+			{
+				return Fail(TEXT("Expression too long"));
+			}
+			Code.Add({ Op, static_cast<uint16>(Threshold), static_cast<uint16>(Operand), 1 });
+			return true;
+		}
+
+		// Put a group instruction in front of the children emitted since First
+		bool Wrap(int32 First, EConceptRequirementOp Op, int32 Threshold, int32 Children)
+		{
+			if (Code.Num() >= MAX_uint16)
+			{
+				return Fail(TEXT("Expression too long"));
+			}
+			Code.Insert({ Op, static_cast<uint16>(Threshold), static_cast<uint16>(Children), static_cast<uint16>(Code.Num() - First + 1) }, First);
+			return true;
+		}
+
+		// Or := And { ('|' | 'or') And }
+		bool ParseOr()
+		{
+			const int32 First = Code.Num();
+			int32 Children = 0;
+			do
+			{
+				if (!ParseAnd())
+				{
+					return false;
+				}
+				++Children;
+			}
+			while (Symbol(TEXT("|")) || Keyword(TEXT("or")));
+
+			return Children == 1 || Wrap(First, EConceptRequirementOp::AtLeast, 1, Children);
+		}
+
+		// And := Unary { ('&' | 'and') Unary }
+		bool ParseAnd()
+		{
+			const int32 First = Code.Num();
+			int32 Children = 0;
+			do
+			{
+				if (!ParseUnary())
+				{
+					return false;
+				}
+				++Children;
+			}
+			while (Symbol(TEXT("&")) || Keyword(TEXT("and")));
+
+			return Children == 1 || Wrap(First, EConceptRequirementOp::AtLeast, Children, Children);
+		}
+
+		// Unary := ('!' | 'not') Unary | Primary
+		bool ParseUnary()
+		{
+			if (++Depth > MaxDepth)
+			{
+				return Fail(TEXT("Expression nested too deeply"));
+			}
+
+			bool bParsed;
+			if (Symbol(TEXT("!")) || Keyword(TEXT("not")))
+			{
+				const int32 First = Code.Num();
+				bParsed = ParseUnary() && Wrap(First, EConceptRequirementOp::Not, 0, 1);
+			}
+			else
+			{
+				bParsed = ParsePrimary();
+			}
+
+			--Depth;
+			return bParsed;
+		}
+
+		// Primary := '(' Or ')' | 'tag' '(' Name ')' | Number 'of' '(' Or { ',' Or } ')' | Name [ '>=' Number ]
+		bool ParsePrimary()
+		{
+			if (Symbol(TEXT("(")))
+			{
+				return ParseOr() && (Symbol(TEXT(")")) || Fail(TEXT("Expected ')'")));
+			}
+
+			SkipSpace();
+			if (FChar::IsDigit(*Cursor))
+			{
+				int32 Needed = 0;
+				if (!ParseNumber(Needed) || !(Keyword(TEXT("of")) || Fail(TEXT("Expected 'of'"))) || !(Symbol(TEXT("(")) || Fail(TEXT("Expected '('"))))
+				{
+					return false;
+				}
+
+				const int32 First = Code.Num();
+				int32 Children = 0;
+				do
+				{
+					if (!ParseOr())
+					{
+						return false;
+					}
+					++Children;
+				}
+				while (Symbol(TEXT(",")));
+
+				if (!Symbol(TEXT(")")))
+				{
+					return Fail(TEXT("Expected ')'"));
+				}
+
+				if (Needed > Children)
+				{
+					return Fail(FString::Printf(TEXT("%d of %d can never be met"), Needed, Children));
+				}
+
+				return Wrap(First, EConceptRequirementOp::AtLeast, Needed, Children);
+			}
+
+			if (Keyword(TEXT("tag")))
+			{
+				FString TagName;
+				if (!(Symbol(TEXT("(")) || Fail(TEXT("Expected '('"))) || !ParseIdentifier(TagName) || !(Symbol(TEXT(")")) || Fail(TEXT("Expected ')'"))))
+				{
+					return false;
+				}
+
+				const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*TagName), false);
+				if (!Tag.IsValid())
+				{
+					return Fail(FString::Printf(TEXT("Unknown gameplay tag %s"), *TagName));
+				}
+
+				return Emit(EConceptRequirementOp::Tag, 0, Tags.AddUnique(Tag));
+			}
+
+			FString Name;
+			if (!ParseIdentifier(Name))
+			{
+				return false;
+			}
+
+			// Concepts are named by asset, and must be listed in RequiredConcepts so they stay in the catalog's masks and bundles
+			const TSoftObjectPtr<UConcept>* Found = RequiredConcepts.FindByPredicate([&Name](const TSoftObjectPtr<UConcept>& Concept)
+			{
+				return Concept.GetAssetName().Equals(Name, ESearchCase::IgnoreCase);
+			});
+			if (!Found)
+			{
+				return Fail(FString::Printf(TEXT("%s is not one of the skill's RequiredConcepts"), *Name));
+			}
+
+			int32 Threshold = DefaultMastery;
+			if (Symbol(TEXT(">=")) && !ParseNumber(Threshold))
+			{
+				return false;
+			}
+
+			return Emit(EConceptRequirementOp::Concept, Threshold, Concepts.AddUnique(Found->ToSoftObjectPath()));
+		}
+	};
+}
+
+bool FConceptRequirementProgram::Compile(const FString& Expression, TConstArrayView<TSoftObjectPtr<UConcept>> RequiredConcepts, int32 DefaultMastery, FString& OutError)
+{
+	Code.Reset();
+	Concepts.Reset();
+	Tags.Reset();
+	OutError.Reset();
+	bCompiled = true;
+
+	DefaultMastery = FMath::Max(DefaultMastery, 0);
+
+	// No expression: every required concept at the shared mastery level
+	if (Expression.TrimStartAndEnd().IsEmpty())
+	{
+		for (const TSoftObjectPtr<UConcept>& Concept : RequiredConcepts)
+		{
+			if (!Concept.IsNull())
+			{
+				Code.Add({ EConceptRequirementOp::Concept, static_cast<uint16>(DefaultMastery), static_cast<uint16>(Concepts.AddUnique(Concept.ToSoftObjectPath())), 1 });
+			}
+		}
+
+		if (Code.Num() == 0)
+		{
+			Code.Add({ EConceptRequirementOp::True, 0, 0, 1 });
+		}
+		else if (Code.Num() > 1)
+		{
+			Code.Insert({ EConceptRequirementOp::AtLeast, static_cast<uint16>(Code.Num()), static_cast<uint16>(Code.Num()), static_cast<uint16>(Code.Num() + 1) }, 0);
+		}
+		return true;
+	}
+
+	ConceptRequirement::FParser Parser{ *Expression, RequiredConcepts, DefaultMastery, Code, Concepts, Tags };
+	bool bParsed = Parser.ParseOr();
+	Parser.SkipSpace();
+	if (bParsed && *Parser.Cursor != TEXT('\0'))
+	{
+		bParsed = Parser.Fail(TEXT("Unexpected text"));
+	}
+
+	if (!bParsed)
+	{
+		// An empty program is never met
+		OutError = Parser.Error;
+		Code.Reset();
+		Concepts.Reset();
+		Tags.Reset();
+	}
+
+	return bParsed;
+}
+
+bool FConceptRequirementProgram::Evaluate(const FConceptRequirementContext& Context) const
+{
+	if (Code.Num() == 0)
+	{
+		return false;
+	}
+
+	int32 PC = 0;
+	return EvaluateAt(Context, PC);
+}
+
+bool FConceptRequirementProgram::Evaluate(const UConceptComponent* Component, const FGameplayTagContainer& OwnerTags) const
+{
+	if (!Component)
+	{
+		return false;
+	}
+
+	return Evaluate(FConceptRequirementContext([Component](const FSoftObjectPath& Path) -> int32
+	{
+		const TSoftObjectPtr<UConcept> Concept(Path);
+		if (!Component->AcquiredConcepts.Contains(Concept))
+		{
+			return INDEX_NONE;
+		}
+		return Component->Slots.GetHighestMastery(Concept.Get());
+	}, OwnerTags));
+}
+
+void FConceptRequirementProgram::GetPositiveConcepts(TArray<FSoftObjectPath>& OutConcepts, TArray<int32>* OutThresholds) const
+{
+	OutConcepts.Reset();
+	if (OutThresholds)
+	{
+		OutThresholds->Reset();
+	}
+
+	for (int32 PC = 0; PC < Code.Num();)
+	{
+		const FConceptRequirementInstruction& Instruction = Code[PC];
+		if (Instruction.Op == EConceptRequirementOp::Not)
+		{
+			// Concepts under a NOT must stay unmet, so the whole subtree is skipped
+			PC += Instruction.Size;
+			continue;
+		}
+
+		if (Instruction.Op == EConceptRequirementOp::Concept)
+		{
+			const int32 Index = OutConcepts.AddUnique(Concepts[Instruction.Operand]);
+			if (OutThresholds)
+			{
+				if (Index == OutThresholds->Num())
+				{
+					OutThresholds->Add(Instruction.Threshold);
+				}
+				else
+				{
+					(*OutThresholds)[Index] = FMath::Max<int32>((*OutThresholds)[Index], Instruction.Threshold);
+				}
+			}
+		}
+		++PC;
+	}
+}
+
+bool FConceptRequirementProgram::IsConjunction() const
+{
+	return Algo::AllOf(Code, [](const FConceptRequirementInstruction& Instruction)
+	{
+		switch (Instruction.Op)
+		{
+		case EConceptRequirementOp::True:
+		case EConceptRequirementOp::Concept:
+			return true;
+		case EConceptRequirementOp::AtLeast:
+			return Instruction.Threshold == Instruction.Operand;
+		default:
+			return false;
+		}
+	});
+}
+
+bool FConceptRequirementProgram::EvaluateAt(const FConceptRequirementContext& Context, int32& PC) const
+{
+	const FConceptRequirementInstruction& Instruction = Code[PC];
+	const int32 End = PC + Instruction.Size;
+
+	switch (Instruction.Op)
+	{
+	case EConceptRequirementOp::True:
+		PC = End;
+		return true;
+
+	case EConceptRequirementOp::Concept:
+	{
+		PC = End;
+		const int32 Mastery = Context.GetMastery(Concepts[Instruction.Operand]);
+		return Mastery != INDEX_NONE && Mastery >= Instruction.Threshold;
+	}
+
+	case EConceptRequirementOp::Tag:
+		PC = End;
+		return Context.OwnerTags.HasTag(Tags[Instruction.Operand]);
+
+	case EConceptRequirementOp::Not:
+		++PC;
+		return !EvaluateAt(Context, PC);
+
+	case EConceptRequirementOp::AtLeast:
+	{
+		++PC;
+		int32 Met = 0;
+		for (int32 Child = 0; Child < Instruction.Operand; ++Child)
+		{
+			// Stop once enough are met, or too few are left to get there; End skips whatever is left
+			if (Met >= Instruction.Threshold || Met + (Instruction.Operand - Child) < Instruction.Threshold)
+			{
+				break;
+			}
+			Met += EvaluateAt(Context, PC) ? 1 : 0;
+		}
+		PC = End;
+		return Met >= Instruction.Threshold;
+	}
+	}
+
+	PC = End;
+	return false;
+}
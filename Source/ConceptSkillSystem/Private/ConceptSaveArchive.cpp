@@ -0,0 +1,484 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptSaveArchive.h"
+#include "ConceptRegistry.h"
+
+FConceptSaveWriter::FConceptSaveWriter(TArray<uint8>& InBuffer, const UConceptRegistry* InRegistry)
+	: Output(InBuffer)
+	, Ar(Payload)
+	, Registry(InRegistry)
+	, bWriteHeader(false)
+	, bFinished(false)
+{
+}
+
+FConceptSaveWriter::~FConceptSaveWriter()
+{
+	ensureMsgf(bFinished || (!bWriteHeader && Payload.Num() == 0), TEXT("FConceptSaveWriter: Finish was never called, so nothing was written."));
+}
+
+void FConceptSaveWriter::WriteHeader()
+{
+	bWriteHeader = true;
+}
+
+void FConceptSaveWriter::Finish(TSet<int32>* InOutDefined)
+{
+	if (bFinished)
+	{
+		return;
+	}
+	bFinished = true;
+
+	FMemoryWriter OutAr(Output, false, true);
+	if (bWriteHeader)
+	{
+		uint32 Magic = ConceptSaveFormat::Magic;
+		uint16 Version = static_cast<uint16>(ConceptSaveFormat::EVersion::Latest);
+		uint32 CatalogHash = Registry ? Registry->GetCatalogHash() : 0;
+
+		OutAr << Magic;
+		OutAr << Version;
+		OutAr << CatalogHash;
+	}
+
+	// The table is size-prefixed so readers on the same catalog can skip it without parsing the paths
+	TArray<int32> NewIndices;
+	NewIndices.Reserve(UsedIndices.Num());
+	for (int32 Index : UsedIndices)
+	{
+		if (!InOutDefined || !InOutDefined->Contains(Index))
+		{
+			NewIndices.Add(Index);
+		}
+	}
+
+	TArray<uint8> Table;
+	if (NewIndices.Num() > 0)
+	{
+		FMemoryWriter TableAr(Table);
+		uint32 NumEntries = NewIndices.Num();
+		TableAr.SerializeIntPacked(NumEntries);
+		for (int32 Index : NewIndices)
+		{
+			uint32 PackedIndex = static_cast<uint32>(Index);
+			FString PathString = UsedPaths.FindChecked(Index).ToString();
+			TableAr.SerializeIntPacked(PackedIndex);
+			TableAr << PathString;
+		}
+
+		if (InOutDefined)
+		{
+			InOutDefined->Append(NewIndices);
+		}
+	}
+
+	uint32 TableSize = Table.Num();
+	OutAr.SerializeIntPacked(TableSize);
+	OutAr.Serialize(Table.GetData(), Table.Num());
+
+	OutAr.Serialize(Payload.GetData(), Payload.Num());
+}
+
+int32 FConceptSaveWriter::GetCatalogIndex(const TSoftObjectPtr<UConcept>& Concept)
+{
+	const int32 Index = Registry ? Registry->GetConceptIndex(Concept) : INDEX_NONE;
+	if (Index == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ConceptSaveWriter: %s is not in the concept catalog and is not saved."), *Concept.ToString());
+		return INDEX_NONE;
+	}
+
+	if (!UsedPaths.Contains(Index))
+	{
+		UsedPaths.Add(Index, Concept.ToSoftObjectPath());
+		UsedIndices.Add(Index);
+	}
+	return Index;
+}
+
+void FConceptSaveWriter::WriteByte(uint8 Value)
+{
+	Ar << Value;
+}
+
+void FConceptSaveWriter::WritePacked(uint32 Value)
+{
+	Ar.SerializeIntPacked(Value);
+}
+
+void FConceptSaveWriter::WriteFloat(float Value)
+{
+	Ar << Value;
+}
+
+void FConceptSaveWriter::WriteInt64(int64 Value)
+{
+	Ar << Value;
+}
+
+void FConceptSaveWriter::WriteString(const FString& Value)
+{
+	FString Copy = Value;
+	Ar << Copy;
+}
+
+void FConceptSaveWriter::WriteGuid(const FGuid& Value)
+{
+	FGuid Copy = Value;
+	Ar << Copy;
+}
+
+void FConceptSaveWriter::WriteConcept(const TSoftObjectPtr<UConcept>& Concept)
+{
+	const int32 Index = Concept.IsNull() ? INDEX_NONE : GetCatalogIndex(Concept);
+	WritePacked(Index == INDEX_NONE ? 0 : static_cast<uint32>(Index) + 1);
+}
+
+void FConceptSaveWriter::WriteConceptSet(const TSet<TSoftObjectPtr<UConcept>>& Concepts)
+{
+	TArray<int32> Indices;
+	Indices.Reserve(Concepts.Num());
+	for (const TSoftObjectPtr<UConcept>& Concept : Concepts)
+	{
+		const int32 Index = Concept.IsNull() ? INDEX_NONE : GetCatalogIndex(Concept);
+		if (Index != INDEX_NONE)
+		{
+			Indices.Add(Index);
+		}
+	}
+
+	// Sorted gaps are small, so they pack into one byte in the common case
+	Indices.Sort();
+	WritePacked(Indices.Num());
+
+	int32 Previous = 0;
+	for (int32 Index : Indices)
+	{
+		WritePacked(static_cast<uint32>(Index - Previous));
+		Previous = Index;
+	}
+}
+
+void FConceptSaveWriter::WriteSlot(const FConceptSlot& Slot, const FConceptSlot& DefaultSlot)
+{
+	uint8 Flags = 0;
+	if (Slot.bIsUnlocked != DefaultSlot.bIsUnlocked)
+	{
+		Flags |= ConceptSaveFormat::SlotFlag_Unlocked;
+	}
+	if (!Slot.HeldConcept.IsNull())
+	{
+		Flags |= ConceptSaveFormat::SlotFlag_Concept;
+	}
+	if (Slot.MasteryLevel != 0)
+	{
+		Flags |= ConceptSaveFormat::SlotFlag_Mastery;
+	}
+	if (Slot.MaxTier != DefaultSlot.MaxTier)
+	{
+		Flags |= ConceptSaveFormat::SlotFlag_MaxTier;
+	}
+	if (Slot.XCoordinate != DefaultSlot.XCoordinate || Slot.YCoordinate != DefaultSlot.YCoordinate)
+	{
+		Flags |= ConceptSaveFormat::SlotFlag_Coordinates;
+	}
+
+	WriteByte(Flags);
+
+	// Slot IDs are random, so they are kept rather than delta-encoded; gameplay code holds on to them
+	WriteGuid(Slot.SlotId);
+
+	if (Flags & ConceptSaveFormat::SlotFlag_Concept)
+	{
+		WriteConcept(Slot.HeldConcept);
+	}
+	if (Flags & ConceptSaveFormat::SlotFlag_Mastery)
+	{
+		WriteByte(Slot.MasteryLevel);
+	}
+	if (Flags & ConceptSaveFormat::SlotFlag_MaxTier)
+	{
+		WriteByte(static_cast<uint8>(Slot.MaxTier));
+	}
+	if (Flags & ConceptSaveFormat::SlotFlag_Coordinates)
+	{
+		WritePacked(static_cast<uint32>(Slot.XCoordinate));
+		WritePacked(static_cast<uint32>(Slot.YCoordinate));
+	}
+}
+
+FConceptSaveReader::FConceptSaveReader(TArrayView<const uint8> InData, const UConceptRegistry* InRegistry)
+	: Ar(InData)
+	, Registry(InRegistry)
+	, Version(0)
+	, CatalogHash(0)
+	, Remap(&OwnRemap)
+{
+}
+
+bool FConceptSaveReader::ReadHeader()
+{
+	uint32 Magic = 0;
+
+	Ar << Magic;
+	Ar << Version;
+	Ar << CatalogHash;
+
+	if (Ar.IsError() || Magic != ConceptSaveFormat::Magic)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ConceptSaveReader: Data is not a concept state blob."));
+		return false;
+	}
+
+	if (Version == 0 || Version > static_cast<uint16>(ConceptSaveFormat::EVersion::Latest))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ConceptSaveReader: Unsupported version %d."), Version);
+		return false;
+	}
+
+	const bool bCatalogMatches = Registry && CatalogHash == Registry->GetCatalogHash();
+	Remap->bCatalogMatches = bCatalogMatches;
+	if (Version < static_cast<uint16>(ConceptSaveFormat::EVersion::PathTable))
+	{
+		// Catalog indices are only meaningful against the catalog they were written with
+		if (!bCatalogMatches)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ConceptSaveReader: Catalog hash mismatch (saved %08x) in a version %d blob."), CatalogHash, Version);
+			return false;
+		}
+		return true;
+	}
+
+	if (!bCatalogMatches)
+	{
+		UE_LOG(LogTemp, Log, TEXT("ConceptSaveReader: Concept catalog changed since the blob was written (saved %08x); resolving concepts by path."), CatalogHash);
+	}
+
+	return ReadPayloadHeader(Version);
+}
+
+bool FConceptSaveReader::ReadPayloadHeader(uint16 InVersion)
+{
+	Version = InVersion;
+	if (Version < static_cast<uint16>(ConceptSaveFormat::EVersion::PathTable))
+	{
+		return true;
+	}
+	return Version == static_cast<uint16>(ConceptSaveFormat::EVersion::PathTable) ? ReadPathTable() : ReadRemapTable();
+}
+
+bool FConceptSaveReader::ReadRemapTable()
+{
+	const uint32 TableSize = ReadPacked();
+	const int64 TableEnd = Ar.Tell() + TableSize;
+	if (Ar.IsError() || TableEnd > Ar.TotalSize())
+	{
+		Ar.SetError();
+		UE_LOG(LogTemp, Warning, TEXT("ConceptSaveReader: Remap table is truncated or corrupt."));
+		return false;
+	}
+
+	// On the catalog the file was written with, the indices are used as they are and the paths never looked at
+	if (Remap->bCatalogMatches && !Remap->bTrackDefined)
+	{
+		Ar.Seek(TableEnd);
+		return true;
+	}
+
+	if (TableSize == 0)
+	{
+		return true;
+	}
+
+	const uint32 NumEntries = ReadPacked();
+	for (uint32 i = 0; i < NumEntries && !Ar.IsError() && Ar.Tell() < TableEnd; ++i)
+	{
+		const uint32 Index = ReadPacked();
+		const FString PathString = ReadString();
+		if (Index > static_cast<uint32>(MAX_int32))
+		{
+			Ar.SetError();
+			break;
+		}
+
+		Remap->Defined.Add(static_cast<int32>(Index));
+		if (Remap->bCatalogMatches)
+		{
+			continue;
+		}
+
+		const FSoftObjectPath Path(PathString);
+		const int32 CatalogIndex = Registry ? Registry->GetConceptIndex(TSoftObjectPtr<UConcept>(Path)) : INDEX_NONE;
+		if (CatalogIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ConceptSaveReader: %s is no longer in the concept catalog and is dropped."), *Path.ToString());
+		}
+		Remap->Concepts.Add(static_cast<int32>(Index), CatalogIndex != INDEX_NONE ? Registry->GetConceptByIndex(CatalogIndex) : nullptr);
+	}
+
+	if (Ar.IsError() || Ar.Tell() != TableEnd)
+	{
+		Ar.SetError();
+		UE_LOG(LogTemp, Warning, TEXT("ConceptSaveReader: Remap table is truncated or corrupt."));
+		return false;
+	}
+	return true;
+}
+
+bool FConceptSaveReader::ReadPathTable()
+{
+	TableConcepts.Reset();
+
+	// Every entry takes at least one byte, which bounds a corrupt count
+	const uint32 NumPaths = ReadPacked();
+	if (Ar.IsError() || NumPaths > static_cast<uint32>(Ar.TotalSize() - Ar.Tell()))
+	{
+		Ar.SetError();
+		UE_LOG(LogTemp, Warning, TEXT("ConceptSaveReader: Path table is truncated or corrupt."));
+		return false;
+	}
+
+	TableConcepts.Reserve(NumPaths);
+	for (uint32 i = 0; i < NumPaths && !Ar.IsError(); ++i)
+	{
+		const FSoftObjectPath Path(ReadString());
+		const int32 CatalogIndex = Registry ? Registry->GetConceptIndex(TSoftObjectPtr<UConcept>(Path)) : INDEX_NONE;
+		if (CatalogIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ConceptSaveReader: %s is no longer in the concept catalog and is dropped."), *Path.ToString());
+		}
+		TableConcepts.Add(CatalogIndex != INDEX_NONE ? Registry->GetConceptByIndex(CatalogIndex) : nullptr);
+	}
+
+	return !Ar.IsError();
+}
+
+UConcept* FConceptSaveReader::ResolveConcept(int32 Index)
+{
+	if (Version != static_cast<uint16>(ConceptSaveFormat::EVersion::PathTable))
+	{
+		if (Version < static_cast<uint16>(ConceptSaveFormat::EVersion::PathTable) || Remap->bCatalogMatches)
+		{
+			return Registry ? Registry->GetConceptByIndex(Index) : nullptr;
+		}
+
+		// Every index a file uses is defined by a remap table at or before its first use
+		UConcept** Remapped = Remap->Concepts.Find(Index);
+		if (!Remapped)
+		{
+			Ar.SetError();
+			return nullptr;
+		}
+		return *Remapped;
+	}
+
+	if (!TableConcepts.IsValidIndex(Index))
+	{
+		Ar.SetError();
+		return nullptr;
+	}
+	return TableConcepts[Index];
+}
+
+uint8 FConceptSaveReader::ReadByte()
+{
+	uint8 Value = 0;
+	Ar << Value;
+	return Value;
+}
+
+uint32 FConceptSaveReader::ReadPacked()
+{
+	uint32 Value = 0;
+	Ar.SerializeIntPacked(Value);
+	return Value;
+}
+
+float FConceptSaveReader::ReadFloat()
+{
+	float Value = 0.0f;
+	Ar << Value;
+	return Value;
+}
+
+int64 FConceptSaveReader::ReadInt64()
+{
+	int64 Value = 0;
+	Ar << Value;
+	return Value;
+}
+
+FString FConceptSaveReader::ReadString()
+{
+	FString Value;
+	Ar << Value;
+	return Value;
+}
+
+FGuid FConceptSaveReader::ReadGuid()
+{
+	FGuid Value;
+	Ar << Value;
+	return Value;
+}
+
+UConcept* FConceptSaveReader::ReadConcept()
+{
+	const uint32 Packed = ReadPacked();
+	if (Packed == 0 || Packed > static_cast<uint32>(MAX_int32))
+	{
+		return nullptr;
+	}
+
+	return ResolveConcept(static_cast<int32>(Packed) - 1);
+}
+
+void FConceptSaveReader::ReadConceptSet(TSet<TSoftObjectPtr<UConcept>>& OutConcepts)
+{
+	OutConcepts.Reset();
+
+	const uint32 Count = ReadPacked();
+	int32 Index = 0;
+	for (uint32 i = 0; i < Count && !Ar.IsError(); ++i)
+	{
+		Index += static_cast<int32>(ReadPacked());
+		if (UConcept* Concept = ResolveConcept(Index))
+		{
+			OutConcepts.Add(Concept);
+		}
+	}
+}
+
+void FConceptSaveReader::ReadSlot(FConceptSlot& InOutSlot)
+{
+	const uint8 Flags = ReadByte();
+
+	// Version 1 blobs didn't keep slot IDs; those slots keep the fresh ID they were initialized with
+	if (Version >= static_cast<uint16>(ConceptSaveFormat::EVersion::PathTable))
+	{
+		InOutSlot.SlotId = ReadGuid();
+	}
+
+	if (Flags & ConceptSaveFormat::SlotFlag_Unlocked)
+	{
+		InOutSlot.bIsUnlocked = !InOutSlot.bIsUnlocked;
+	}
+	if (Flags & ConceptSaveFormat::SlotFlag_Concept)
+	{
+		InOutSlot.HeldConcept = ReadConcept();
+	}
+	if (Flags & ConceptSaveFormat::SlotFlag_Mastery)
+	{
+		InOutSlot.MasteryLevel = FMath::Min<uint8>(ReadByte(), 100);
+	}
+	if (Flags & ConceptSaveFormat::SlotFlag_MaxTier)
+	{
+		InOutSlot.MaxTier = static_cast<EConceptTier>(FMath::Min<uint8>(ReadByte(), static_cast<uint8>(EConceptTier::Abstract)));
+	}
+	if (Flags & ConceptSaveFormat::SlotFlag_Coordinates)
+	{
+		InOutSlot.XCoordinate = static_cast<int32>(ReadPacked());
+		InOutSlot.YCoordinate = static_cast<int32>(ReadPacked());
+	}
+}
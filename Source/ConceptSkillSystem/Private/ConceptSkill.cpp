@@ -3,6 +3,9 @@
 #include "ConceptSkill.h"
 #include "ConceptSkillTags.h"
 #include "Abilities/ConceptAbility.h"
+#include "GameplayEffect.h"
+#include "Engine/Texture2D.h"
+#include "Misc/ScopeExit.h"
 
 UConceptSkill::UConceptSkill()
 {
@@ -10,6 +13,7 @@ UConceptSkill::UConceptSkill()
 	RequiredMasteryLevel = 50;
 	Power = 10;
 	Cooldown = 5.0f;
+	InputID = INDEX_NONE;
 
 	// Initialize with default tags
 	SkillTags.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Skill")));
@@ -74,15 +78,94 @@ bool UConceptSkill::HasSkillTag(const FGameplayTag& Tag) const
 	return SkillTags.HasTag(Tag);
 }
 
+TSubclassOf<UGameplayAbility> UConceptSkill::ResolveGrantedAbility() const
+{
+	if (GrantedAbility.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (UClass* AbilityClass = GrantedAbility.Get())
+	{
+		return AbilityClass;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("Skill %s: ability %s was not prefetched and is loading synchronously"), *GetName(), *GrantedAbility.ToString());
+	return GrantedAbility.LoadSynchronous();
+}
+
+TArray<TSubclassOf<UGameplayEffect>> UConceptSkill::ResolveGrantedEffects() const
+{
+	TArray<TSubclassOf<UGameplayEffect>> Effects;
+	Effects.Reserve(GrantedEffects.Num());
+
+	for (const TSoftClassPtr<UGameplayEffect>& EffectPtr : GrantedEffects)
+	{
+		if (EffectPtr.IsNull())
+		{
+			continue;
+		}
+
+		UClass* EffectClass = EffectPtr.Get();
+		if (!EffectClass)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Skill %s: effect %s was not prefetched and is loading synchronously"), *GetName(), *EffectPtr.ToString());
+			EffectClass = EffectPtr.LoadSynchronous();
+		}
+
+		if (EffectClass)
+		{
+			Effects.Add(EffectClass);
+		}
+	}
+
+	return Effects;
+}
+
+void UConceptSkill::GetGrantedClassPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (!GrantedAbility.IsNull())
+	{
+		OutPaths.Add(GrantedAbility.ToSoftObjectPath());
+	}
+
+	for (const TSoftClassPtr<UGameplayEffect>& EffectPtr : GrantedEffects)
+	{
+		if (!EffectPtr.IsNull())
+		{
+			OutPaths.Add(EffectPtr.ToSoftObjectPath());
+		}
+	}
+}
+
+bool UConceptSkill::AreGrantedClassesLoaded() const
+{
+	if (!GrantedAbility.IsNull() && !GrantedAbility.Get())
+	{
+		return false;
+	}
+
+	for (const TSoftClassPtr<UGameplayEffect>& EffectPtr : GrantedEffects)
+	{
+		if (!EffectPtr.IsNull() && !EffectPtr.Get())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 FGameplayAbilitySpec UConceptSkill::GetAbilitySpec(int32 Level) const
 {
-	if (!GrantedAbility)
+	TSubclassOf<UGameplayAbility> AbilityClass = ResolveGrantedAbility();
+	if (!AbilityClass)
 	{
 		return FGameplayAbilitySpec();
 	}
 
 	// Create the ability spec
-	FGameplayAbilitySpec AbilitySpec(GrantedAbility, Level, INDEX_NONE);
+	FGameplayAbilitySpec AbilitySpec(AbilityClass, Level, InputID);
 
 	// Set the source object to this skill
 	AbilitySpec.SourceObject = const_cast<UConceptSkill*>(this);
@@ -100,3 +183,71 @@ FGameplayAbilitySpec UConceptSkill::GetAbilitySpec(int32 Level) const
 
 	return AbilitySpec;
 }
+
+void UConceptSkill::Serialize(FArchive& Ar)
+{
+	if (!ConceptServerData::IsCookingForServer(Ar))
+	{
+		Super::Serialize(Ar);
+		return;
+	}
+
+	// Same as UConcept: display data is saved empty for server targets and restored afterwards
+	FText SavedDisplayName = MoveTemp(DisplayName);
+	FText SavedDescription = MoveTemp(Description);
+	TSoftObjectPtr<UTexture2D> SavedIcon = MoveTemp(Icon);
+	DisplayName = FText::GetEmpty();
+	Description = FText::GetEmpty();
+	Icon.Reset();
+
+	ON_SCOPE_EXIT
+	{
+		DisplayName = MoveTemp(SavedDisplayName);
+		Description = MoveTemp(SavedDescription);
+		Icon = MoveTemp(SavedIcon);
+	};
+
+	Super::Serialize(Ar);
+}
+
+void UConceptSkill::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileRequirements();
+}
+
+#if WITH_EDITOR
+void UConceptSkill::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileRequirements();
+}
+#endif
+
+void UConceptSkill::CompileRequirements()
+{
+	FString Error;
+	if (!RequirementProgram.Compile(RequirementExpression, RequiredConcepts, RequiredMasteryLevel, Error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Skill %s: requirement expression \"%s\" does not compile and can never be met: %s"), *GetName(), *RequirementExpression, *Error);
+	}
+}
+
+const FConceptRequirementProgram& UConceptSkill::GetRequirementProgram()
+{
+	check(IsInGameThread());
+
+	if (!RequirementProgram.IsCompiled())
+	{
+		CompileRequirements();
+	}
+
+	return RequirementProgram;
+}
+
+SIZE_T UConceptSkill::GetDisplayDataSize() const
+{
+	return ConceptServerData::GetDisplayDataSize(DisplayName, Description, Icon);
+}
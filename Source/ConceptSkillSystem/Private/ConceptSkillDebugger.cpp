@@ -6,7 +6,7 @@
 
 AConceptSkillDebugger::AConceptSkillDebugger()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 	bDebugOnBeginPlay = true;
 }
 
@@ -21,11 +21,6 @@ void AConceptSkillDebugger::BeginPlay()
 	}
 }
 
-void AConceptSkillDebugger::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
 void AConceptSkillDebugger::DebugConceptComponent()
 {
 	UConceptComponent* ConceptComp = GetConceptComponent();
@@ -38,10 +33,10 @@ void AConceptSkillDebugger::DebugConceptComponent()
 	PrintDebug(TEXT("Concept Component Debug Information:"), FColor::Green);
 
 	// Print information about body part slots
-	for (const auto& Pair : ConceptComp->BodyPartSlots)
+	for (const auto& Pair : ConceptComp->MaxSlotsPerBodyPart)
 	{
 		EBodyPartType BodyPart = Pair.Key;
-		const TArray<FConceptSlot>& Slots = Pair.Value;
+		const TArray<FConceptSlot> Slots = ConceptComp->GetSlotsForBodyPart(BodyPart);
 
 		FString BodyPartName;
 		switch (BodyPart)
@@ -138,26 +133,20 @@ bool AConceptSkillDebugger::IncreaseMastery(UConcept* Concept, int32 Amount)
 	}
 
 	// Find the slot containing the concept
-	for (const auto& Pair : ConceptComp->BodyPartSlots)
+	for (const FConceptSlot& Slot : ConceptComp->Slots.Items)
 	{
-		EBodyPartType BodyPart = Pair.Key;
-		const TArray<FConceptSlot>& Slots = Pair.Value;
-
-		for (const FConceptSlot& Slot : Slots)
+		if (!Slot.IsEmpty() && Slot.HeldConcept.Get() == Concept)
 		{
-			if (!Slot.IsEmpty() && Slot.HeldConcept.Get() == Concept)
+			bool Success = ConceptComp->IncreaseMastery(Slot.SlotId, Amount);
+			if (Success)
+			{
+				PrintDebug(FString::Printf(TEXT("Successfully increased mastery of concept '%s' by %d"), *Concept->GetName(), Amount), FColor::Green);
+			}
+			else
 			{
-				bool Success = ConceptComp->IncreaseMastery(Slot.SlotId, Amount);
-				if (Success)
-				{
-					PrintDebug(FString::Printf(TEXT("Successfully increased mastery of concept '%s' by %d"), *Concept->GetName(), Amount), FColor::Green);
-				}
-				else
-				{
-					PrintDebug(FString::Printf(TEXT("Failed to increase mastery of concept '%s'"), *Concept->GetName()), FColor::Red);
-				}
-				return Success;
+				PrintDebug(FString::Printf(TEXT("Failed to increase mastery of concept '%s'"), *Concept->GetName()), FColor::Red);
 			}
+			return Success;
 		}
 	}
 
@@ -2,6 +2,7 @@
 
 #include "ConceptSkillFunctionLibrary.h"
 #include "ConceptObservable.h"
+#include "ConceptObservationSubsystem.h"
 
 UConceptComponent* UConceptSkillFunctionLibrary::GetConceptComponent(AActor* Actor)
 {
@@ -36,6 +37,13 @@ bool UConceptSkillFunctionLibrary::CanObserveConcept(AActor* Observer, AActor* O
 		return false;
 	}
 
+	// Cooldowns are tracked per observer, so another observer's visit doesn't block this one
+	const UConceptObservationSubsystem* Observation = UConceptObservationSubsystem::Get(Observable);
+	if (Observation && Observation->IsObservationOnCooldown(Observer, Observable))
+	{
+		return false;
+	}
+
 	// Check if the observable can be observed
 	return IConceptObservable::Execute_CanBeObserved(Observable);
 }
@@ -161,7 +169,7 @@ bool UConceptSkillFunctionLibrary::HasAvailableSlotForConcept(AActor* Actor, UCo
 	}
 
 	// If no suitable slot found in the target body part, try other body parts
-	for (const auto& Pair : ConceptComp->BodyPartSlots)
+	for (const auto& Pair : ConceptComp->MaxSlotsPerBodyPart)
 	{
 		if (Pair.Key != TargetBodyPart)
 		{
@@ -189,20 +197,7 @@ int32 UConceptSkillFunctionLibrary::GetConceptMasteryLevel(AActor* Actor, UConce
 	}
 
 	// Check each body part for the concept and find the highest mastery level
-	int32 HighestMastery = 0;
-
-	for (const auto& Pair : ConceptComp->BodyPartSlots)
-	{
-		const TArray<FConceptSlot>& Slots = Pair.Value;
-
-		for (const FConceptSlot& Slot : Slots)
-		{
-			if (!Slot.IsEmpty() && Slot.HeldConcept.Get() == Concept)
-			{
-				HighestMastery = FMath::Max(HighestMastery, Slot.MasteryLevel);
-			}
-		}
-	}
+	int32 HighestMastery = ConceptComp->GetHighestMasteryLevel(Concept);
 
 	return HighestMastery;
 }
@@ -222,8 +217,15 @@ TArray<UConceptSkill*> UConceptSkillFunctionLibrary::GetPossibleSkillsFromConcep
 		return PossibleSkills;
 	}
 
+	auto GetMastery = [&Concepts](const FSoftObjectPath& Path) -> int32
+	{
+		UConcept* Concept = Cast<UConcept>(Path.ResolveObject());
+		return Concept && Concepts.Contains(Concept) ? MAX_uint16 : INDEX_NONE;
+	};
+	const FConceptRequirementContext Context(GetMastery, FGameplayTagContainer::EmptyContainer);
+
 	// Get all skills from the registry
-	for (const auto& SkillPtr : Registry->AllSkills)
+	for (const auto& SkillPtr : Registry->GetAllSkills())
 	{
 		UConceptSkill* Skill = SkillPtr.Get();
 		if (!Skill)
@@ -231,19 +233,8 @@ TArray<UConceptSkill*> UConceptSkillFunctionLibrary::GetPossibleSkillsFromConcep
 			continue;
 		}
 
-		// Check if all the required concepts for this skill are in the provided concepts array
-		bool HasAllRequiredConcepts = true;
-		for (const auto& RequiredConcept : Skill->RequiredConcepts)
-		{
-			UConcept* Concept = RequiredConcept.Get();
-			if (!Concept || !Concepts.Contains(Concept))
-			{
-				HasAllRequiredConcepts = false;
-				break;
-			}
-		}
-
-		if (HasAllRequiredConcepts)
+		// Run the skill's requirement program as if every provided concept were fully mastered
+		if (Skill->GetRequirementProgram().Evaluate(Context))
 		{
 			PossibleSkills.Add(Skill);
 		}
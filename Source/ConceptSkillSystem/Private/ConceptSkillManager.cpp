@@ -6,10 +6,29 @@
 #include "Abilities/ConceptGameplayEffect.h"
 #include "ConceptSkillTags.h"
 #include "GameplayCueManager.h"
+#include "ConceptSystemSubsystem.h"
+#include "ConceptCatalog.h"
+#include "Engine/AssetManager.h"
+
+namespace ConceptCueDispatch
+{
+	// Execution count of the batch entry HandleGameplayCue is routing; cue notifies run synchronously within it
+	static int32 DispatchedCount = 1;
+}
 
 UConceptSkillManager::UConceptSkillManager()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Merged gameplay cues are flushed by UConceptSystemSubsystem, not a tick of our own
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// Batched gameplay cues are sent through this component
+	SetIsReplicatedByDefault(true);
+
+	bAggregateGameplayCues = true;
+	MaxCuesPerBatch = 32;
+	bUnlockEvaluationQueued = false;
+	bGrantsPending = false;
+	PrefetchRequirementDistance = 1;
 }
 
 void UConceptSkillManager::BeginPlay()
@@ -23,6 +42,10 @@ void UConceptSkillManager::BeginPlay()
 	if (ConceptComponent)
 	{
 		AbilitySystemComponent = ConceptComponent->GetAbilitySystemComponent();
+
+		// Re-evaluate unlocks in the world-wide batch whenever concept state changes
+		ConceptComponent->OnConceptAcquired.AddDynamic(this, &UConceptSkillManager::HandleConceptAcquired);
+		ConceptComponent->OnConceptMasteryChanged.AddDynamic(this, &UConceptSkillManager::HandleConceptMasteryChanged);
 	}
 	else
 	{
@@ -32,16 +55,63 @@ void UConceptSkillManager::BeginPlay()
 	// Check for skills that can be unlocked with starting concepts
 	CheckForNewSkills();
 
-	// Grant abilities for already unlocked skills
-	GrantAbilitiesForUnlockedSkills();
+	// Tag terms aren't covered by the concept delegates above
+	RegisterRequirementTagEvents();
 
-	// Apply passive effects
-	ApplyPassiveEffects();
+	// Grant abilities and apply passive effects for already unlocked skills over the next frames
+	QueueAbilityGrants();
 }
 
-void UConceptSkillManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UConceptSkillManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	UnregisterRequirementTagEvents();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UConceptSkillManager::RegisterRequirementTagEvents()
+{
+	UnregisterRequirementTagEvents();
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	for (const TSoftObjectPtr<UConceptSkill>& SkillPtr : AvailableSkills)
+	{
+		UConceptSkill* Skill = SkillPtr.Get();
+		if (!Skill)
+		{
+			continue;
+		}
+
+		for (const FGameplayTag& Tag : Skill->GetRequirementProgram().GetTags())
+		{
+			if (!RequirementTagHandles.Contains(Tag))
+			{
+				RequirementTagHandles.Add(Tag, AbilitySystemComponent->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved)
+					.AddUObject(this, &UConceptSkillManager::HandleRequirementTagChanged));
+			}
+		}
+	}
+}
+
+void UConceptSkillManager::UnregisterRequirementTagEvents()
+{
+	if (AbilitySystemComponent)
+	{
+		for (const TPair<FGameplayTag, FDelegateHandle>& Pair : RequirementTagHandles)
+		{
+			AbilitySystemComponent->RegisterGameplayTagEvent(Pair.Key, EGameplayTagEventType::NewOrRemoved).Remove(Pair.Value);
+		}
+	}
+	RequirementTagHandles.Reset();
+}
+
+void UConceptSkillManager::HandleRequirementTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	// Previews keep their tags off the ability system, so every change seen here is a real one
+	MarkUnlockStateDirty();
 }
 
 void UConceptSkillManager::CheckForNewSkills()
@@ -51,17 +121,207 @@ void UConceptSkillManager::CheckForNewSkills()
 		return;
 	}
 
-	// Check each available skill to see if it can be unlocked
+	// Same path as the batched evaluation, run immediately for this manager alone
+	FConceptUnlockSnapshot Snapshot;
+	BuildUnlockSnapshot(Snapshot);
+	Snapshot.Evaluate();
+	CommitUnlockSnapshot(Snapshot);
+}
+
+void UConceptSkillManager::MarkUnlockStateDirty()
+{
+	if (bUnlockEvaluationQueued)
+	{
+		return;
+	}
+
+	if (UConceptSystemSubsystem* ConceptSystem = UConceptSystemSubsystem::Get(this))
+	{
+		bUnlockEvaluationQueued = true;
+		ConceptSystem->QueueUnlockEvaluation(this);
+	}
+	else
+	{
+		CheckForNewSkills();
+	}
+}
+
+void UConceptSkillManager::BuildUnlockSnapshot(FConceptUnlockSnapshot& OutSnapshot) const
+{
+	OutSnapshot.MasteryByConcept.Reset();
+	OutSnapshot.Candidates.Reset();
+	OutSnapshot.Eligible.Reset();
+	OutSnapshot.NearUnlock.Reset();
+	OutSnapshot.PrefetchDistance = PrefetchRequirementDistance;
+	OutSnapshot.OwnerTags.Reset();
+
+	if (!ConceptComponent)
+	{
+		return;
+	}
+
+	OutSnapshot.OwnerTags = ConceptComponent->GetEffectiveOwnedTags();
+
+	for (const TSoftObjectPtr<UConcept>& Concept : ConceptComponent->AcquiredConcepts)
+	{
+		OutSnapshot.MasteryByConcept.Add(Concept.ToSoftObjectPath(), 0);
+	}
+
+	for (const FConceptSlot& Slot : ConceptComponent->Slots.Items)
+	{
+		if (int32* Mastery = OutSnapshot.MasteryByConcept.Find(Slot.HeldConcept.ToSoftObjectPath()))
+		{
+			*Mastery = FMath::Max<int32>(*Mastery, Slot.MasteryLevel);
+		}
+	}
+
 	for (const auto& SkillPtr : AvailableSkills)
 	{
 		UConceptSkill* Skill = SkillPtr.Get();
-		if (Skill && !UnlockedSkills.Contains(Skill))
+		if (Skill && !UnlockedSkills.Contains(Skill) && !DeferredUnlocks.Contains(Skill))
 		{
-			if (CanUnlockSkill(Skill))
+			// Compiled here, so the off-thread evaluation only reads
+			Skill->GetRequirementProgram();
+			OutSnapshot.Candidates.Add(Skill);
+		}
+	}
+}
+
+void UConceptSkillManager::CommitUnlockSnapshot(const FConceptUnlockSnapshot& Snapshot)
+{
+	bUnlockEvaluationQueued = false;
+
+	PrefetchSkillClasses(Snapshot.NearUnlock);
+
+	for (UConceptSkill* Skill : Snapshot.Eligible)
+	{
+		UnlockWhenLoaded(Skill);
+	}
+}
+
+void UConceptSkillManager::UnlockWhenLoaded(UConceptSkill* Skill)
+{
+	if (DeferredUnlocks.Contains(Skill))
+	{
+		return;
+	}
+
+	// Eligible skills that were never near enough to prefetch (e.g. unlockable at BeginPlay) start streaming now
+	TSharedPtr<FStreamableHandle>& Handle = PrefetchHandles.FindOrAdd(Skill);
+	if (!Handle.IsValid() && !Skill->AreGrantedClassesLoaded())
+	{
+		TArray<FSoftObjectPath> Paths;
+		Skill->GetGrantedClassPaths(Paths);
+		if (Paths.Num() > 0)
+		{
+			Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+		}
+	}
+
+	if (Handle.IsValid() && Handle->IsLoadingInProgress())
+	{
+		DeferredUnlocks.Add(Skill);
+		const FStreamableDelegate OnLoaded = FStreamableDelegate::CreateUObject(this, &UConceptSkillManager::HandleDeferredUnlockLoaded, TWeakObjectPtr<UConceptSkill>(Skill));
+		Handle->BindCompleteDelegate(OnLoaded);
+		Handle->BindCancelDelegate(OnLoaded);
+		return;
+	}
+
+	UnlockSkill(Skill);
+
+	// Granted now, so the ability system holds the classes
+	PrefetchHandles.Remove(Skill);
+}
+
+void UConceptSkillManager::HandleDeferredUnlockLoaded(TWeakObjectPtr<UConceptSkill> Skill)
+{
+	if (!Skill.IsValid() || DeferredUnlocks.Remove(Skill.Get()) == 0)
+	{
+		return;
+	}
+
+	PrefetchHandles.Remove(Skill.Get());
+
+	// Concept state may have changed while the classes streamed in
+	if (CanUnlockSkill(Skill.Get()))
+	{
+		UnlockSkill(Skill.Get());
+	}
+}
+
+void UConceptSkillManager::PrefetchSkillClasses(TConstArrayView<UConceptSkill*> Skills)
+{
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	for (UConceptSkill* Skill : Skills)
+	{
+		if (PrefetchHandles.Contains(Skill) || Skill->AreGrantedClassesLoaded())
+		{
+			continue;
+		}
+
+		TArray<FSoftObjectPath> Paths;
+		Skill->GetGrantedClassPaths(Paths);
+		if (Paths.Num() > 0)
+		{
+			PrefetchHandles.Add(Skill, Streamable.RequestAsyncLoad(Paths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority));
+		}
+	}
+}
+
+void UConceptSkillManager::HandleConceptAcquired(UConcept* Concept, FConceptSlot Slot)
+{
+	MarkUnlockStateDirty();
+}
+
+void UConceptSkillManager::HandleConceptMasteryChanged(UConcept* Concept, int32 NewMasteryLevel)
+{
+	MarkUnlockStateDirty();
+}
+
+void FConceptUnlockSnapshot::Evaluate()
+{
+	Eligible.Reset();
+
+	NearUnlock.Reset();
+
+	auto GetMastery = [this](const FSoftObjectPath& Path) -> int32
+	{
+		const int32* Mastery = MasteryByConcept.Find(Path);
+		return Mastery ? *Mastery : INDEX_NONE;
+	};
+	const FConceptRequirementContext Context(GetMastery, OwnerTags);
+
+	TArray<FSoftObjectPath> PositiveConcepts;
+	TArray<int32> Thresholds;
+	for (UConceptSkill* Skill : Candidates)
+	{
+		// Mirrors CanUnlockSkill: the skill's compiled requirement program
+		if (Skill->AreRequirementsMet(Context))
+		{
+			Eligible.Add(Skill);
+			continue;
+		}
+
+		// Prefetching only needs an estimate: the program's concept terms still short of their own thresholds.
+		// OR and N-of-M terms are counted as if all were needed, which only makes the estimate conservative.
+		Skill->GetCompiledRequirementProgram().GetPositiveConcepts(PositiveConcepts, &Thresholds);
+		int32 Unmet = 0;
+		for (int32 Term = 0; Term < PositiveConcepts.Num(); ++Term)
+		{
+			const int32* Mastery = MasteryByConcept.Find(PositiveConcepts[Term]);
+			if (!Mastery || *Mastery < Thresholds[Term])
 			{
-				UnlockSkill(Skill);
+				if (++Unmet > PrefetchDistance)
+				{
+					break;
+				}
 			}
 		}
+
+		if (Unmet <= PrefetchDistance)
+		{
+			NearUnlock.Add(Skill);
+		}
 	}
 }
 
@@ -79,14 +339,22 @@ bool UConceptSkillManager::UnlockSkill(UConceptSkill* Skill)
 	CategorizeSkill(Skill);
 
 	// Grant the ability if it's an active skill
-	if (Skill->ManifestationType == ESkillManifestationType::Active && Skill->GrantedAbility)
+	if (Skill->ManifestationType == ESkillManifestationType::Active && Skill->HasGrantedAbility())
 	{
 		GrantAbilityForSkill(Skill);
 	}
 	// Apply passive effects if it's a passive ability
 	else if (Skill->ManifestationType == ESkillManifestationType::Passive && Skill->GrantedEffects.Num() > 0)
 	{
-		ApplyPassiveEffects();
+		// While a grant queue is draining, the new passive joins it instead of reapplying every passive now
+		if (bGrantsPending)
+		{
+			EnqueueGrant(Skill);
+		}
+		else
+		{
+			ApplyPassiveEffects();
+		}
 	}
 
 	// Broadcast delegate
@@ -109,7 +377,7 @@ bool UConceptSkillManager::RemoveSkill(UConceptSkill* Skill)
 	RemoveSkillFromCategory(Skill);
 
 	// Remove the ability if it's an active skill
-	if (Skill->ManifestationType == ESkillManifestationType::Active && Skill->GrantedAbility)
+	if (Skill->ManifestationType == ESkillManifestationType::Active && Skill->HasGrantedAbility())
 	{
 		RemoveAbilityForSkill(Skill);
 	}
@@ -132,45 +400,72 @@ bool UConceptSkillManager::CanUnlockSkill(UConceptSkill* Skill) const
 		return false;
 	}
 
-	// Check if all required concepts are acquired with sufficient mastery
-	for (const auto& RequiredConcept : Skill->RequiredConcepts)
+	// The skill's requirement program: its expression, or every required concept at the required mastery
+	// During a preview, the tags it granted count too
+	return Skill->GetRequirementProgram().Evaluate(ConceptComponent, ConceptComponent->GetEffectiveOwnedTags());
+}
+
+TArray<FConceptSkillProximity> UConceptSkillManager::GetNearestUnlockableSkills(int32 Count)
+{
+	TArray<FConceptSkillProximity> Nearest;
+	if (!ConceptComponent || Count <= 0)
 	{
-		UConcept* Concept = RequiredConcept.Get();
-		if (!Concept || !ConceptComponent->HasAcquiredConcept(Concept))
-		{
-			return false; // Missing a required concept
-		}
+		return Nearest;
+	}
 
-		// Check mastery level
-		bool HasSufficientMastery = false;
+	const FConceptCatalog& Catalog = FConceptCatalog::GetPublished();
+	if (!SkillProximity.IsBuiltFor(Catalog, AvailableSkills))
+	{
+		SkillProximity.Build(Catalog, AvailableSkills);
+	}
 
-		// Check each body part for the concept with sufficient mastery
-		for (const auto& Pair : ConceptComponent->BodyPartSlots)
+	// Acquired concepts as a bitset and highest mastery per slotted concept, both by catalog index
+	TArray<uint64, TInlineAllocator<256>> Acquired;
+	Acquired.SetNumZeroed(Catalog.MaskWords);
+	for (const TSoftObjectPtr<UConcept>& Concept : ConceptComponent->AcquiredConcepts)
+	{
+		const int32 Index = Catalog.GetConceptIndex(Concept.ToSoftObjectPath());
+		if (Index != INDEX_NONE)
 		{
-			const TArray<FConceptSlot>& Slots = Pair.Value;
-
-			for (const FConceptSlot& Slot : Slots)
-			{
-				if (!Slot.IsEmpty() && Slot.HeldConcept.Get() == Concept && Slot.MasteryLevel >= Skill->RequiredMasteryLevel)
-				{
-					HasSufficientMastery = true;
-					break;
-				}
-			}
+			Acquired[Index >> 6] |= uint64(1) << (Index & 63);
+		}
+	}
 
-			if (HasSufficientMastery)
-			{
-				break;
-			}
+	TMap<int32, uint8> Mastery;
+	Mastery.Reserve(ConceptComponent->Slots.Items.Num());
+	for (const FConceptSlot& Slot : ConceptComponent->Slots.Items)
+	{
+		const int32 Index = Slot.IsEmpty() ? INDEX_NONE : Catalog.GetConceptIndex(Slot.HeldConcept.ToSoftObjectPath());
+		if (Index != INDEX_NONE)
+		{
+			uint8& Level = Mastery.FindOrAdd(Index, 0);
+			Level = FMath::Max(Level, Slot.MasteryLevel);
 		}
+	}
 
-		if (!HasSufficientMastery)
+	TBitArray<> Unlocked(false, SkillProximity.Num());
+	for (const TPair<FName, UConceptSkill*>& Pair : UnlockedSkills)
+	{
+		const int32 Position = Pair.Value ? SkillProximity.GetPosition(Catalog.GetSkillIndex(FSoftObjectPath(Pair.Value))) : INDEX_NONE;
+		if (Position != INDEX_NONE)
 		{
-			return false; // Insufficient mastery for a required concept
+			Unlocked[Position] = true;
 		}
 	}
 
-	return true; // All requirements met
+	TArray<FConceptSkillProximityResult> Results;
+	SkillProximity.FindNearest(Acquired, Mastery, Unlocked, Count, Results);
+
+	Nearest.Reserve(Results.Num());
+	for (const FConceptSkillProximityResult& Result : Results)
+	{
+		FConceptSkillProximity& Entry = Nearest.AddDefaulted_GetRef();
+		Entry.Skill = SkillProximity.GetSkill(Result.Position);
+		Entry.MissingConcepts = Result.Missing;
+		Entry.MasteryDeficit = Result.Deficit;
+	}
+
+	return Nearest;
 }
 
 TArray<TSoftObjectPtr<UConceptSkill>> UConceptSkillManager::GetSkillsByType(ESkillManifestationType Type) const
@@ -200,19 +495,14 @@ TMap<TSoftObjectPtr<UConcept>, int32> UConceptSkillManager::GetConceptMasteryLev
 	}
 
 	// Gather mastery levels from all body part slots
-	for (const auto& Pair : ConceptComponent->BodyPartSlots)
+	for (const FConceptSlot& Slot : ConceptComponent->Slots.Items)
 	{
-		const TArray<FConceptSlot>& Slots = Pair.Value;
-
-		for (const FConceptSlot& Slot : Slots)
+		if (!Slot.IsEmpty())
 		{
-			if (!Slot.IsEmpty())
+			// If the concept already exists in the map, keep the highest mastery level
+			if (!MasteryLevels.Contains(Slot.HeldConcept) || MasteryLevels[Slot.HeldConcept] < Slot.MasteryLevel)
 			{
-				// If the concept already exists in the map, keep the highest mastery level
-				if (!MasteryLevels.Contains(Slot.HeldConcept) || MasteryLevels[Slot.HeldConcept] < Slot.MasteryLevel)
-				{
-					MasteryLevels.Add(Slot.HeldConcept, Slot.MasteryLevel);
-				}
+				MasteryLevels.Add(Slot.HeldConcept, Slot.MasteryLevel);
 			}
 		}
 	}
@@ -295,7 +585,7 @@ void UConceptSkillManager::GrantAbilitiesForUnlockedSkills()
 	for (const auto& SkillPtr : ActiveSkills)
 	{
 		UConceptSkill* Skill = SkillPtr.Get();
-		if (Skill && Skill->GrantedAbility)
+		if (Skill && Skill->HasGrantedAbility())
 		{
 			GrantAbilityForSkill(Skill);
 		}
@@ -304,7 +594,7 @@ void UConceptSkillManager::GrantAbilitiesForUnlockedSkills()
 
 FGameplayAbilitySpecHandle UConceptSkillManager::GrantAbilityForSkill(UConceptSkill* Skill)
 {
-	if (!Skill || !Skill->GrantedAbility || !AbilitySystemComponent)
+	if (!Skill || !Skill->HasGrantedAbility() || !AbilitySystemComponent)
 	{
 		return FGameplayAbilitySpecHandle();
 	}
@@ -372,7 +662,7 @@ void UConceptSkillManager::UpdateAbilityLevels()
 	for (const auto& SkillPtr : ActiveSkills)
 	{
 		UConceptSkill* Skill = SkillPtr.Get();
-		if (!Skill || !Skill->GrantedAbility)
+		if (!Skill || !Skill->HasGrantedAbility())
 		{
 			continue;
 		}
@@ -416,6 +706,22 @@ void UConceptSkillManager::ApplyPassiveEffects()
 	// Remove all existing passive effects first
 	// This is a simplistic approach - in a real implementation, you might want to track
 	// which effects are applied and only remove/update as needed
+	RemovePassiveEffects();
+
+	// Every passive is applied here, so none are left for the grant queue
+	GrantQueues[static_cast<int32>(EConceptGrantPriority::Passive)].Reset();
+
+	// Apply effects for all passive abilities
+	for (const auto& SkillPtr : PassiveAbilities)
+	{
+		ApplyPassiveEffectsForSkill(SkillPtr.Get());
+	}
+
+	FinishGrantsIfDrained();
+}
+
+void UConceptSkillManager::RemovePassiveEffects()
+{
 	TArray<FActiveGameplayEffectHandle> EffectsToRemove;
 	for (const auto& Pair : AbilitySystemComponent->GetActiveGameplayEffects().GetActiveEffects())
 	{
@@ -430,42 +736,218 @@ void UConceptSkillManager::ApplyPassiveEffects()
 	{
 		AbilitySystemComponent->RemoveActiveGameplayEffect(Handle);
 	}
+}
 
-	// Apply effects for all passive abilities
-	for (const auto& SkillPtr : PassiveAbilities)
+void UConceptSkillManager::ApplyPassiveEffectsForSkill(UConceptSkill* Skill)
+{
+	if (!Skill || !AbilitySystemComponent)
 	{
-		UConceptSkill* Skill = SkillPtr.Get();
-		if (!Skill)
+		return;
+	}
+
+	// Calculate the effective power of the skill
+	int32 EffectivePower = CalculateSkillEffectivePower(Skill);
+
+	// Convert to a reasonable level value (1-10)
+	float Level = FMath::Max(1.0f, FMath::Min(10.0f, EffectivePower / 10.0f));
+
+	// Apply each effect
+	for (TSubclassOf<UGameplayEffect> EffectClass : Skill->ResolveGrantedEffects())
+	{
+		if (EffectClass)
 		{
-			continue;
+			FGameplayEffectContextHandle EffectContext = AbilitySystemComponent->MakeEffectContext();
+			EffectContext.AddSourceObject(Skill);
+
+			FGameplayEffectSpecHandle SpecHandle = AbilitySystemComponent->MakeOutgoingSpec(EffectClass, Level, EffectContext);
+			if (SpecHandle.IsValid())
+			{
+				// Set the source skill as a set-by-caller magnitude
+				SpecHandle.Data->SetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(TEXT("Data.SkillPower")), EffectivePower);
+
+				// Apply the effect
+				AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+			}
 		}
+	}
+}
 
-		// Calculate the effective power of the skill
-		int32 EffectivePower = CalculateSkillEffectivePower(Skill);
+void UConceptSkillManager::QueueAbilityGrants()
+{
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	// Skills already granted (or already queued) are left alone, so calling this again only adds what is missing
+	for (const TArray<TSoftObjectPtr<UConceptSkill>>* Category : { &ActiveSkills, &PassiveAbilities })
+	{
+		for (const TSoftObjectPtr<UConceptSkill>& SkillPtr : *Category)
+		{
+			EnqueueGrant(SkillPtr.Get());
+		}
+	}
 
-		// Convert to a reasonable level value (1-10)
-		float Level = FMath::Max(1.0f, FMath::Min(10.0f, EffectivePower / 10.0f));
+	bGrantsPending = true;
+	FinishGrantsIfDrained();
+	if (!bGrantsPending)
+	{
+		return;
+	}
 
-		// Apply each effect
-		for (TSubclassOf<UGameplayEffect> EffectClass : Skill->GrantedEffects)
+	// Stream in every class the queue needs; the concept system waits for it instead of loading synchronously
+	TArray<FSoftObjectPath> Paths;
+	for (const TArray<TWeakObjectPtr<UConceptSkill>>& Queue : GrantQueues)
+	{
+		for (const TWeakObjectPtr<UConceptSkill>& Skill : Queue)
 		{
-			if (EffectClass)
+			if (Skill.IsValid() && !Skill->AreGrantedClassesLoaded())
 			{
-				FGameplayEffectContextHandle EffectContext = AbilitySystemComponent->MakeEffectContext();
-				EffectContext.AddSourceObject(Skill);
+				Skill->GetGrantedClassPaths(Paths);
+			}
+		}
+	}
+	GrantLoadHandle = Paths.Num() > 0 ? UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority) : nullptr;
 
-				FGameplayEffectSpecHandle SpecHandle = AbilitySystemComponent->MakeOutgoingSpec(EffectClass, Level, EffectContext);
-				if (SpecHandle.IsValid())
-				{
-					// Set the source skill as a set-by-caller magnitude
-					SpecHandle.Data->SetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(TEXT("Data.SkillPower")), EffectivePower);
+	// Without the concept system (e.g. in editor preview worlds) drain the queue right away
+	UConceptSystemSubsystem* ConceptSystem = UConceptSystemSubsystem::Get(this);
+	if (ConceptSystem)
+	{
+		ConceptSystem->QueueAbilityGrants(this);
+		return;
+	}
 
-					// Apply the effect
-					AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-				}
+	if (GrantLoadHandle.IsValid())
+	{
+		GrantLoadHandle->WaitUntilComplete();
+	}
+
+	for (int32 Priority = 0; Priority < static_cast<int32>(EConceptGrantPriority::Count); ++Priority)
+	{
+		while (HasPendingGrants(static_cast<EConceptGrantPriority>(Priority)))
+		{
+			ProcessNextGrant(static_cast<EConceptGrantPriority>(Priority));
+		}
+	}
+}
+
+void UConceptSkillManager::EnqueueGrant(UConceptSkill* Skill)
+{
+	if (!Skill)
+	{
+		return;
+	}
+
+	// Mirrors UnlockSkill: actives grant an ability, passives apply effects, and other skills have nothing to grant
+	EConceptGrantPriority Priority;
+	bool bHasWork;
+	switch (Skill->ManifestationType)
+	{
+	case ESkillManifestationType::Active:
+		Priority = Skill->InputID != INDEX_NONE ? EConceptGrantPriority::InputBound : EConceptGrantPriority::Active;
+		bHasWork = Skill->HasGrantedAbility();
+		break;
+	case ESkillManifestationType::Passive:
+		Priority = EConceptGrantPriority::Passive;
+		bHasWork = Skill->GrantedEffects.Num() > 0;
+		break;
+	default:
+		return;
+	}
+
+	if (bHasWork && !IsSkillGranted(Skill))
+	{
+		GrantQueues[static_cast<int32>(Priority)].AddUnique(Skill);
+	}
+}
+
+bool UConceptSkillManager::IsSkillGranted(const UConceptSkill* Skill) const
+{
+	if (!Skill || !AbilitySystemComponent)
+	{
+		return false;
+	}
+
+	if (Skill->ManifestationType == ESkillManifestationType::Passive)
+	{
+		// Passive effects carry their skill as the context's source object
+		for (const auto& Pair : AbilitySystemComponent->GetActiveGameplayEffects().GetActiveEffects())
+		{
+			if (Pair.Value.Spec.GetEffectContext().GetSourceObject() == Skill)
+			{
+				return true;
 			}
 		}
+		return false;
+	}
+
+	for (const FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
+	{
+		if (Spec.SourceObject == Skill)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UConceptSkillManager::AreAbilitiesReady() const
+{
+	return !bGrantsPending;
+}
+
+bool UConceptSkillManager::IsReadyToGrant() const
+{
+	return !GrantLoadHandle.IsValid() || GrantLoadHandle->HasLoadCompleted() || GrantLoadHandle->WasCanceled();
+}
+
+bool UConceptSkillManager::HasPendingGrants(EConceptGrantPriority Priority) const
+{
+	return GrantQueues[static_cast<int32>(Priority)].Num() > 0;
+}
+
+void UConceptSkillManager::ProcessNextGrant(EConceptGrantPriority Priority)
+{
+	TArray<TWeakObjectPtr<UConceptSkill>>& Queue = GrantQueues[static_cast<int32>(Priority)];
+	if (Queue.Num() == 0)
+	{
+		return;
+	}
+
+	// Granted in the order queued
+	UConceptSkill* Skill = Queue[0].Get();
+	Queue.RemoveAt(0, 1, false);
+
+	if (Priority == EConceptGrantPriority::Passive)
+	{
+		ApplyPassiveEffectsForSkill(Skill);
+	}
+	else
+	{
+		GrantAbilityForSkill(Skill);
+	}
+
+	FinishGrantsIfDrained();
+}
+
+void UConceptSkillManager::FinishGrantsIfDrained()
+{
+	if (!bGrantsPending)
+	{
+		return;
+	}
+
+	for (const TArray<TWeakObjectPtr<UConceptSkill>>& Queue : GrantQueues)
+	{
+		if (Queue.Num() > 0)
+		{
+			return;
+		}
 	}
+
+	bGrantsPending = false;
+	GrantLoadHandle.Reset();
+	OnAbilitiesReady.Broadcast();
 }
 
 TArray<UConceptSkill*> UConceptSkillManager::GetSkillsWithTag(const FGameplayTag& Tag) const
@@ -485,6 +967,110 @@ TArray<UConceptSkill*> UConceptSkillManager::GetSkillsWithTag(const FGameplayTag
 }
 
 void UConceptSkillManager::ExecuteCue(const FGameplayTag& Tag, const FGameplayCueParameters& Parameters)
+{
+	QueueGameplayCue(GetOwner(), Tag, Parameters, Parameters.RawMagnitude > 0.0f ? Parameters.RawMagnitude : 1.0f);
+}
+
+void UConceptSkillManager::QueueGameplayCue(AActor* Target, FGameplayTag CueTag, const FGameplayCueParameters& Parameters, float Magnitude)
+{
+	if (!Target || !CueTag.IsValid())
+	{
+		return;
+	}
+
+	// Merge with an execution already queued this frame for the same target and tag
+	const TPair<TObjectKey<AActor>, FGameplayTag> Key(Target, CueTag);
+	if (const int32* ExistingIndex = PendingCueIndices.Find(Key))
+	{
+		FConceptCueBatchEntry& Entry = PendingCues[*ExistingIndex];
+		Entry.Count = static_cast<uint16>(FMath::Min<int32>(Entry.Count + 1, MAX_uint16));
+		Entry.CombinedMagnitude += Magnitude;
+	}
+	else
+	{
+		FConceptCueBatchEntry& Entry = PendingCues.AddDefaulted_GetRef();
+		Entry.Target = Target;
+		Entry.CueTag = CueTag;
+		Entry.Parameters = Parameters;
+		Entry.Count = 1;
+		Entry.CombinedMagnitude = Magnitude;
+		PendingCueIndices.Add(Key, PendingCues.Num() - 1);
+	}
+
+	// Without aggregation (or nothing to flush at the end of the frame) every execution goes out immediately
+	UConceptSystemSubsystem* ConceptSystem = bAggregateGameplayCues ? UConceptSystemSubsystem::Get(this) : nullptr;
+	if (!ConceptSystem)
+	{
+		FlushPendingCues();
+	}
+	else if (PendingCues.Num() == 1 && PendingCues[0].Count == 1)
+	{
+		// First execution this frame
+		ConceptSystem->QueueCueFlush(this);
+	}
+}
+
+void UConceptSkillManager::FlushPendingCues()
+{
+	if (PendingCues.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FConceptCueBatchEntry> Batch = MoveTemp(PendingCues);
+	PendingCues.Reset();
+	PendingCueIndices.Reset();
+
+	// The server sends every target's cues in one multicast, which also executes locally
+	// Clients only play their own predicted cues
+	AActor* Owner = GetOwner();
+	if (Owner && Owner->HasAuthority() && GetNetMode() != NM_Standalone)
+	{
+		// Keep each unreliable multicast small enough that one dropped packet only loses a few cues
+		const int32 ChunkSize = FMath::Max(MaxCuesPerBatch, 1);
+		if (Batch.Num() <= ChunkSize)
+		{
+			MulticastExecuteCueBatch(Batch);
+		}
+		else
+		{
+			TArray<FConceptCueBatchEntry> Chunk;
+			for (int32 First = 0; First < Batch.Num(); First += ChunkSize)
+			{
+				Chunk.Reset();
+				Chunk.Append(Batch.GetData() + First, FMath::Min(ChunkSize, Batch.Num() - First));
+				MulticastExecuteCueBatch(Chunk);
+			}
+		}
+	}
+	else
+	{
+		DispatchCueBatch(Batch);
+	}
+}
+
+void UConceptSkillManager::MulticastExecuteCueBatch_Implementation(const TArray<FConceptCueBatchEntry>& Batch)
+{
+	// The owning client already played the cues its own skills caused when it predicted them
+	if (GetOwnerRole() == ROLE_AutonomousProxy)
+	{
+		TArray<FConceptCueBatchEntry> RemoteBatch;
+		for (const FConceptCueBatchEntry& Entry : Batch)
+		{
+			if (Entry.Parameters.EffectCauser.Get() != GetOwner())
+			{
+				RemoteBatch.Add(Entry);
+			}
+		}
+
+		DispatchCueBatch(RemoteBatch);
+		return;
+	}
+
+	DispatchCueBatch(Batch);
+}
+
+void UConceptSkillManager::DispatchCueBatch(const TArray<FConceptCueBatchEntry>& Batch) const
 {
 	// Get the gameplay cue manager
 	UGameplayCueManager* GameplayCueManager = UAbilitySystemGlobals::Get().GetGameplayCueManager();
@@ -493,8 +1079,26 @@ void UConceptSkillManager::ExecuteCue(const FGameplayTag& Tag, const FGameplayCu
 		return;
 	}
 
-	// Execute the gameplay cue
-	GameplayCueManager->HandleGameplayCue(GetOwner(), Tag, EGameplayCueEvent::Executed, Parameters);
+	for (const FConceptCueBatchEntry& Entry : Batch)
+	{
+		if (!Entry.Target)
+		{
+			continue;
+		}
+
+		// Execute the merged gameplay cue once with the combined magnitude; the effect level is left as handlers expect it,
+		// and the execution count is available to them through GetDispatchedCueCount
+		FGameplayCueParameters Parameters = Entry.Parameters;
+		Parameters.RawMagnitude = Entry.CombinedMagnitude;
+
+		TGuardValue<int32> CountGuard(ConceptCueDispatch::DispatchedCount, FMath::Max<int32>(Entry.Count, 1));
+		GameplayCueManager->HandleGameplayCue(Entry.Target, Entry.CueTag, EGameplayCueEvent::Executed, Parameters);
+	}
+}
+
+int32 UConceptSkillManager::GetDispatchedCueCount()
+{
+	return ConceptCueDispatch::DispatchedCount;
 }
 
 void UConceptSkillManager::ForwardGameplayCueToParent()
@@ -502,7 +1106,7 @@ void UConceptSkillManager::ForwardGameplayCueToParent()
 	// Default implementation does nothing
 }
 
-void UConceptSkillManager::ExecuteGameplayCueForSkill(UConceptSkill* Skill, AActor* Target)
+void UConceptSkillManager::ExecuteGameplayCueForSkill(UConceptSkill* Skill, AActor* Target, float Magnitude)
 {
 	if (!Skill || !Target)
 	{
@@ -587,6 +1191,6 @@ void UConceptSkillManager::ExecuteGameplayCueForSkill(UConceptSkill* Skill, AAct
 		SkillGameplayCueTags.Add(Skill, CueTag);
 	}
 
-	// Execute the gameplay cue
-	ExecuteCue(CueTag, Parameters);
+	// Queue the gameplay cue so executions on the same target this frame are merged
+	QueueGameplayCue(Target, CueTag, Parameters, Magnitude);
 }
@@ -0,0 +1,171 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptSkillProximity.h"
+#include "ConceptCatalog.h"
+#include "ConceptSkill.h"
+
+void FConceptSkillProximityIndex::Build(const FConceptCatalog& Catalog, TConstArrayView<TSoftObjectPtr<UConceptSkill>> InSkills)
+{
+	Skills.Reset();
+	ThresholdStarts.Reset();
+	ThresholdConcepts.Reset();
+	ThresholdLevels.Reset();
+	WordStarts.Reset();
+	WordIndices.Reset();
+	WordBits.Reset();
+	PositionBySkillIndex.Init(INDEX_NONE, Catalog.Skills.Num());
+	CatalogVersion = Catalog.Version;
+	NumSourceSkills = InSkills.Num();
+	SourceHash = HashSkills(InSkills);
+
+	TArray<FSoftObjectPath> PositiveConcepts;
+	TArray<int32> Thresholds;
+	TArray<int32> ConceptIndices;
+	WordStarts.Add(0);
+	ThresholdStarts.Add(0);
+	for (const TSoftObjectPtr<UConceptSkill>& Skill : InSkills)
+	{
+		const int32 SkillIndex = Catalog.GetSkillIndex(Skill.ToSoftObjectPath());
+		if (SkillIndex == INDEX_NONE || PositionBySkillIndex[SkillIndex] != INDEX_NONE)
+		{
+			continue;
+		}
+
+		PositionBySkillIndex[SkillIndex] = Skills.Num();
+		Skills.Add(Skill);
+
+		// The Gameplay bundle the catalog loads holds the requirement expression
+		UConceptSkill* Loaded = Skill.Get();
+
+		// The catalog mask ANDs every RequiredConcept, which the expression may not; it stays the fallback for unloaded skills
+		if (Loaded)
+		{
+			Loaded->GetRequirementProgram().GetPositiveConcepts(PositiveConcepts, &Thresholds);
+			ConceptIndices.Reset();
+			for (int32 Term = 0; Term < PositiveConcepts.Num(); ++Term)
+			{
+				const int32 ConceptIndex = Catalog.GetConceptIndex(PositiveConcepts[Term]);
+				if (ConceptIndex != INDEX_NONE)
+				{
+					ConceptIndices.Add(ConceptIndex);
+
+					// Thresholds of 0 only need the concept acquired, which Missing already counts
+					if (Thresholds[Term] > 0)
+					{
+						ThresholdConcepts.Add(ConceptIndex);
+						ThresholdLevels.Add(static_cast<uint8>(FMath::Min(Thresholds[Term], 255)));
+					}
+				}
+			}
+
+			// Sorted, so each word's bits are adjacent
+			ConceptIndices.Sort();
+			for (const int32 ConceptIndex : ConceptIndices)
+			{
+				const uint32 Word = static_cast<uint32>(ConceptIndex) >> 6;
+				if (static_cast<uint32>(WordIndices.Num()) == WordStarts.Last() || WordIndices.Last() != Word)
+				{
+					WordIndices.Add(Word);
+					WordBits.Add(0);
+				}
+				WordBits.Last() |= uint64(1) << (ConceptIndex & 63);
+			}
+		}
+		else
+		{
+			const TConstArrayView<uint64> Mask = Catalog.GetRequirementMask(SkillIndex);
+			for (int32 Word = 0; Word < Mask.Num(); ++Word)
+			{
+				if (Mask[Word] != 0)
+				{
+					WordIndices.Add(Word);
+					WordBits.Add(Mask[Word]);
+				}
+			}
+		}
+		WordStarts.Add(WordIndices.Num());
+		ThresholdStarts.Add(ThresholdConcepts.Num());
+	}
+}
+
+bool FConceptSkillProximityIndex::IsBuiltFor(const FConceptCatalog& Catalog, TConstArrayView<TSoftObjectPtr<UConceptSkill>> InSkills) const
+{
+	return CatalogVersion == Catalog.Version && NumSourceSkills == InSkills.Num() && SourceHash == HashSkills(InSkills);
+}
+
+uint32 FConceptSkillProximityIndex::HashSkills(TConstArrayView<TSoftObjectPtr<UConceptSkill>> InSkills)
+{
+	// Soft paths hash their names, so this is one combine per skill and never touches the assets
+	uint32 Hash = 0;
+	for (const TSoftObjectPtr<UConceptSkill>& Skill : InSkills)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Skill.ToSoftObjectPath()));
+	}
+	return Hash;
+}
+
+void FConceptSkillProximityIndex::FindNearest(TConstArrayView<uint64> Acquired, const TMap<int32, uint8>& Mastery, const TBitArray<>& Excluded, int32 K,
+	TArray<FConceptSkillProximityResult>& OutNearest) const
+{
+	OutNearest.Reset();
+	if (K <= 0)
+	{
+		return;
+	}
+
+	// Max-heap of the best K so far: the root is the worst kept result, the one a better skill replaces
+	auto WorseFirst = [](const FConceptSkillProximityResult& A, const FConceptSkillProximityResult& B) { return B < A; };
+	OutNearest.Reserve(K);
+
+	const uint64* AcquiredWords = Acquired.GetData();
+	const uint32* Indices = WordIndices.GetData();
+	const uint64* Bits = WordBits.GetData();
+
+	for (int32 Position = 0; Position < Skills.Num(); ++Position)
+	{
+		if (Excluded.IsValidIndex(Position) && Excluded[Position])
+		{
+			continue;
+		}
+
+		const uint32 First = WordStarts[Position];
+		const uint32 Last = WordStarts[Position + 1];
+
+		int32 Missing = 0;
+		for (uint32 Word = First; Word < Last; ++Word)
+		{
+			Missing += FMath::CountBits(Bits[Word] & ~AcquiredWords[Indices[Word]]);
+		}
+
+		const bool bFull = OutNearest.Num() == K;
+		if (bFull && Missing > OutNearest.HeapTop().Missing)
+		{
+			continue;
+		}
+
+		// Only acquired requirements can be short on mastery
+		int32 Deficit = 0;
+		for (uint32 Term = ThresholdStarts[Position]; Term < ThresholdStarts[Position + 1]; ++Term)
+		{
+			const int32 Concept = ThresholdConcepts[Term];
+			if ((AcquiredWords[Concept >> 6] >> (Concept & 63)) & 1)
+			{
+				const uint8* ConceptMastery = Mastery.Find(Concept);
+				Deficit += FMath::Max(static_cast<int32>(ThresholdLevels[Term]) - static_cast<int32>(ConceptMastery ? *ConceptMastery : 0), 0);
+			}
+		}
+
+		const FConceptSkillProximityResult Result = { Position, Missing, Deficit };
+		if (!bFull)
+		{
+			OutNearest.HeapPush(Result, WorseFirst);
+		}
+		else if (Result < OutNearest.HeapTop())
+		{
+			OutNearest.HeapPopDiscard(WorseFirst, false);
+			OutNearest.HeapPush(Result, WorseFirst);
+		}
+	}
+
+	OutNearest.Sort();
+}
@@ -3,6 +3,7 @@
 #include "ConceptSkillSystemModule.h"
 #include "Modules/ModuleManager.h"
 #include "ConceptSkillTags.h"
+#include "ConceptCatalog.h"
 
 IMPLEMENT_MODULE(FConceptSkillSystemModule, ConceptSkillSystem);
 
@@ -20,4 +21,7 @@ void FConceptSkillSystemModule::ShutdownModule()
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 	UE_LOG(LogTemp, Log, TEXT("Concept Skill System Module has been unloaded"));
+
+	// The shared catalog outlives every game instance, so it is released with the module
+	FConceptCatalog::Release();
 }
@@ -1,6 +1,7 @@
 // Copyright Koorogi Games, Inc. All Rights Reserved.
 
 #include "ConceptSlot.h"
+#include "ConceptComponent.h"
 
 FConceptSlot::FConceptSlot()
 {
@@ -9,6 +10,8 @@ FConceptSlot::FConceptSlot()
 	MasteryLevel = 0;
 	MaxTier = EConceptTier::Physical;
 	SlotId = FGuid::NewGuid();
+	XCoordinate = 0;
+	YCoordinate = 0;
 }
 
 bool FConceptSlot::IsEmpty() const
@@ -58,6 +61,78 @@ void FConceptSlot::IncreaseMastery(int32 Amount)
 {
 	if (!IsEmpty())
 	{
-		MasteryLevel = FMath::Clamp(MasteryLevel + Amount, 0, 100);
+		MasteryLevel = static_cast<uint8>(FMath::Clamp<int32>(MasteryLevel + Amount, 0, 100));
 	}
 }
+
+void FConceptSlot::PostReplicatedAdd(const FConceptSlotContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleReplicatedSlotChanged(*this);
+	}
+}
+
+void FConceptSlot::PostReplicatedChange(const FConceptSlotContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleReplicatedSlotChanged(*this);
+	}
+}
+
+FConceptSlot& FConceptSlotContainer::AddSlot(const FConceptSlot& Slot)
+{
+	FConceptSlot& NewSlot = Items.Add_GetRef(Slot);
+	MarkItemDirty(NewSlot);
+	return NewSlot;
+}
+
+void FConceptSlotContainer::Reset()
+{
+	Items.Reset();
+	MarkArrayDirty();
+}
+
+FConceptSlot* FConceptSlotContainer::FindById(const FGuid& SlotId)
+{
+	return Items.FindByPredicate([&SlotId](const FConceptSlot& Slot) { return Slot.SlotId == SlotId; });
+}
+
+const FConceptSlot* FConceptSlotContainer::FindById(const FGuid& SlotId) const
+{
+	return Items.FindByPredicate([&SlotId](const FConceptSlot& Slot) { return Slot.SlotId == SlotId; });
+}
+
+TArray<FConceptSlot> FConceptSlotContainer::GetSlotsForBodyPart(EBodyPartType BodyPart) const
+{
+	TArray<FConceptSlot> BodyPartSlots;
+	for (const FConceptSlot& Slot : Items)
+	{
+		if (Slot.BodyPart == BodyPart)
+		{
+			BodyPartSlots.Add(Slot);
+		}
+	}
+
+	return BodyPartSlots;
+}
+
+int32 FConceptSlotContainer::GetHighestMastery(const UConcept* Concept) const
+{
+	int32 HighestMastery = 0;
+	if (!Concept)
+	{
+		return HighestMastery;
+	}
+
+	for (const FConceptSlot& Slot : Items)
+	{
+		if (!Slot.IsEmpty() && Slot.HeldConcept.Get() == Concept)
+		{
+			HighestMastery = FMath::Max<int32>(HighestMastery, Slot.MasteryLevel);
+		}
+	}
+
+	return HighestMastery;
+}
@@ -0,0 +1,40 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptStateSnapshot.h"
+#include "ConceptComponent.h"
+
+void FConceptSlotUndo::Capture(const FConceptSlot& Slot)
+{
+	HeldConcept = Slot.HeldConcept;
+	BodyPart = Slot.BodyPart;
+	MaxTier = Slot.MaxTier;
+	MasteryLevel = Slot.MasteryLevel;
+	bIsUnlocked = Slot.bIsUnlocked;
+}
+
+void FConceptSlotUndo::Restore(FConceptSlot& Slot) const
+{
+	Slot.HeldConcept = HeldConcept;
+	Slot.BodyPart = BodyPart;
+	Slot.MaxTier = MaxTier;
+	Slot.MasteryLevel = MasteryLevel;
+	Slot.bIsUnlocked = bIsUnlocked;
+}
+
+FConceptPreviewScope::FConceptPreviewScope(UConceptComponent* InComponent)
+	: Component(InComponent)
+	, Key(0)
+{
+	if (InComponent)
+	{
+		Key = InComponent->BeginPreviewSnapshot();
+	}
+}
+
+FConceptPreviewScope::~FConceptPreviewScope()
+{
+	if (UConceptComponent* ConceptComponent = Component.Get())
+	{
+		ConceptComponent->RestoreSnapshot(Key);
+	}
+}
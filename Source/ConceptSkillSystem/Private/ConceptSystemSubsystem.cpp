@@ -0,0 +1,218 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#include "ConceptSystemSubsystem.h"
+#include "ConceptComponent.h"
+#include "ConceptSkillManager.h"
+#include "ConceptObservationSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+
+UConceptSystemSubsystem::UConceptSystemSubsystem()
+{
+	FrameBudgetFraction = 0.1f;
+	MinBudgetMs = 0.25f;
+	MaxBudgetMs = 2.0f;
+	GrantBudgetMs = 1.0f;
+	SmoothedDeltaTime = 1.0f / 60.0f;
+}
+
+void UConceptSystemSubsystem::Deinitialize()
+{
+	PendingGrants.Empty();
+	PendingUnlockEvaluations.Empty();
+	PendingCueFlushes.Empty();
+	PendingSummaries.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UConceptSystemSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UConceptSystemSubsystem, STATGROUP_Tickables);
+}
+
+UConceptSystemSubsystem* UConceptSystemSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UConceptSystemSubsystem>() : nullptr;
+}
+
+double UConceptSystemSubsystem::GetFrameBudget() const
+{
+	const float BudgetMs = FMath::Clamp(SmoothedDeltaTime * 1000.0f * FrameBudgetFraction, MinBudgetMs, MaxBudgetMs);
+	return BudgetMs / 1000.0;
+}
+
+void UConceptSystemSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SmoothedDeltaTime = FMath::Lerp(SmoothedDeltaTime, DeltaTime, 0.1f);
+
+	const double Start = FPlatformTime::Seconds();
+	const double Deadline = Start + GetFrameBudget();
+
+	ProcessGrants();
+
+	// Unlocks can grant abilities and queue cues, so they run before the flush
+	EvaluatePendingUnlocks();
+
+	FlushCues();
+
+	// Observation cooldowns, range queries and sessions; sessions take what is left of the budget
+	if (UConceptObservationSubsystem* Observation = GetWorld()->GetSubsystem<UConceptObservationSubsystem>())
+	{
+		Observation->Update(DeltaTime, FMath::Max(Deadline - FPlatformTime::Seconds(), 0.0));
+	}
+
+	UpdateSummaries(GetWorld()->GetTimeSeconds(), Deadline);
+}
+
+void UConceptSystemSubsystem::QueueAbilityGrants(UConceptSkillManager* SkillManager)
+{
+	if (SkillManager)
+	{
+		PendingGrants.AddUnique(SkillManager);
+	}
+}
+
+void UConceptSystemSubsystem::ProcessGrants()
+{
+	PendingGrants.RemoveAll([](const TWeakObjectPtr<UConceptSkillManager>& SkillManager) { return !SkillManager.IsValid(); });
+	if (PendingGrants.Num() == 0)
+	{
+		return;
+	}
+
+	// Every character's input-bound abilities come before anyone's passives
+	// Indexed loops: OnAbilitiesReady handlers may queue more grants
+	// At least one grant goes through per tick, so even a zero budget drains the queues
+	const double Deadline = FPlatformTime::Seconds() + GrantBudgetMs / 1000.0;
+	bool bGrantedAny = false;
+	bool bOutOfBudget = false;
+	for (int32 Priority = 0; Priority < static_cast<int32>(EConceptGrantPriority::Count) && !bOutOfBudget; ++Priority)
+	{
+		const EConceptGrantPriority GrantPriority = static_cast<EConceptGrantPriority>(Priority);
+		for (int32 Index = 0; Index < PendingGrants.Num() && !bOutOfBudget; ++Index)
+		{
+			while (UConceptSkillManager* SkillManager = PendingGrants[Index].Get())
+			{
+				// Managers still streaming in their classes wait for a later frame
+				if (!SkillManager->IsReadyToGrant() || !SkillManager->HasPendingGrants(GrantPriority))
+				{
+					break;
+				}
+
+				if (bGrantedAny && FPlatformTime::Seconds() > Deadline)
+				{
+					bOutOfBudget = true;
+					break;
+				}
+
+				SkillManager->ProcessNextGrant(GrantPriority);
+				bGrantedAny = true;
+			}
+		}
+	}
+
+	PendingGrants.RemoveAll([](const TWeakObjectPtr<UConceptSkillManager>& SkillManager) { return !SkillManager.IsValid() || SkillManager->AreAbilitiesReady(); });
+}
+
+void UConceptSystemSubsystem::QueueCueFlush(UConceptSkillManager* SkillManager)
+{
+	if (SkillManager)
+	{
+		PendingCueFlushes.AddUnique(SkillManager);
+	}
+}
+
+void UConceptSystemSubsystem::QueueUnlockEvaluation(UConceptSkillManager* SkillManager)
+{
+	if (SkillManager)
+	{
+		PendingUnlockEvaluations.Add(SkillManager);
+	}
+}
+
+void UConceptSystemSubsystem::EvaluatePendingUnlocks()
+{
+	if (PendingUnlockEvaluations.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<UConceptSkillManager*> SkillManagers;
+	SkillManagers.Reserve(PendingUnlockEvaluations.Num());
+	for (const TWeakObjectPtr<UConceptSkillManager>& SkillManager : PendingUnlockEvaluations)
+	{
+		if (SkillManager.IsValid())
+		{
+			SkillManagers.Add(SkillManager.Get());
+		}
+	}
+	PendingUnlockEvaluations.Reset();
+
+	// Snapshots are taken on the game thread so the parallel pass never touches live components
+	TArray<FConceptUnlockSnapshot> Snapshots;
+	Snapshots.SetNum(SkillManagers.Num());
+	for (int32 Index = 0; Index < SkillManagers.Num(); ++Index)
+	{
+		SkillManagers[Index]->BuildUnlockSnapshot(Snapshots[Index]);
+	}
+
+	ParallelFor(Snapshots.Num(), [&Snapshots](int32 Index)
+	{
+		Snapshots[Index].Evaluate();
+	});
+
+	// Unlocking grants abilities and broadcasts delegates, which must happen on the game thread
+	for (int32 Index = 0; Index < SkillManagers.Num(); ++Index)
+	{
+		SkillManagers[Index]->CommitUnlockSnapshot(Snapshots[Index]);
+	}
+}
+
+void UConceptSystemSubsystem::QueueSummaryUpdate(UConceptComponent* Component)
+{
+	if (Component)
+	{
+		PendingSummaries.HeapPush({ Component, GetWorld()->GetTimeSeconds() + Component->SummaryUpdateInterval });
+	}
+}
+
+void UConceptSystemSubsystem::FlushCues()
+{
+	TArray<TWeakObjectPtr<UConceptSkillManager>> Flushes = MoveTemp(PendingCueFlushes);
+	PendingCueFlushes.Reset();
+
+	for (const TWeakObjectPtr<UConceptSkillManager>& SkillManager : Flushes)
+	{
+		if (SkillManager.IsValid())
+		{
+			SkillManager->FlushPendingCues();
+		}
+	}
+}
+
+void UConceptSystemSubsystem::UpdateSummaries(double Now, double Deadline)
+{
+	int32 Processed = 0;
+	while (PendingSummaries.Num() > 0)
+	{
+		// The heap top is the earliest due, so once it isn't due, none is.
+		// Summaries run after everything else, so one due summary is always rebuilt even when the budget is spent.
+		if (PendingSummaries.HeapTop().DueTime > Now || (Processed > 0 && FPlatformTime::Seconds() > Deadline))
+		{
+			break;
+		}
+
+		FPendingSummary Pending;
+		PendingSummaries.HeapPop(Pending, false);
+		++Processed;
+
+		if (UConceptComponent* Component = Pending.Component.Get())
+		{
+			Component->UpdatePublicSummary();
+		}
+	}
+}
@@ -1,10 +1,12 @@
 // Copyright Koorogi Games, Inc. All Rights Reserved.
 
 #include "ConceptualObject.h"
+#include "ConceptRegistry.h"
+#include "ConceptSaveArchive.h"
 
 AConceptualObject::AConceptualObject()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	Quality = EObjectQuality::Common;
 	Durability = 100;
@@ -17,11 +19,6 @@ void AConceptualObject::BeginPlay()
 	InitializeSlots();
 }
 
-void AConceptualObject::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
 void AConceptualObject::InitializeSlots()
 {
 	// Clear existing slots
@@ -29,20 +26,24 @@ void AConceptualObject::InitializeSlots()
 	
 	// Create slots based on quality
 	int32 NumSlots = GetMaxSlots();
-	EConceptTier MaxTier = GetMaxConceptTier();
 	
 	for (int32 i = 0; i < NumSlots; ++i)
 	{
-		FConceptSlot NewSlot;
-		NewSlot.BodyPart = EBodyPartType::None; // Object slots aren't tied to body parts
-		NewSlot.bIsUnlocked = (i == 0); // Only the first slot is unlocked by default
-		NewSlot.MaxTier = MaxTier;
-		NewSlot.SlotId = FGuid::NewGuid();
-		
-		ConceptSlots.Add(NewSlot);
+		ConceptSlots.Add(MakeDefaultSlot(i));
 	}
 }
 
+FConceptSlot AConceptualObject::MakeDefaultSlot(int32 Index) const
+{
+	FConceptSlot NewSlot;
+	NewSlot.BodyPart = EBodyPartType::None; // Object slots aren't tied to body parts
+	NewSlot.bIsUnlocked = (Index == 0); // Only the first slot is unlocked by default
+	NewSlot.MaxTier = GetMaxConceptTier();
+	NewSlot.SlotId = FGuid::NewGuid();
+	
+	return NewSlot;
+}
+
 bool AConceptualObject::AddConcept(UConcept* Concept, bool bRiskDegradation)
 {
 	if (!Concept)
@@ -336,3 +337,102 @@ bool AConceptualObject::OverSlotConcept(UConcept* Concept)
         }
     }
 }
+
+bool AConceptualObject::SaveObjectState(TArray<uint8>& OutData) const
+{
+	const UConceptRegistry* Registry = UConceptRegistry::GetConceptRegistry(this);
+	if (!Registry)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SaveObjectState: No concept registry available."));
+		return false;
+	}
+
+	OutData.Reset();
+	FConceptSaveWriter Writer(OutData, Registry);
+	Writer.WriteHeader();
+
+	// Quality and durability are only written when they differ from a fresh object
+	const AConceptualObject* Defaults = GetDefault<AConceptualObject>(GetClass());
+	uint8 SectionFlags = 0;
+	if (Quality != Defaults->Quality)
+	{
+		SectionFlags |= SaveSection_Quality;
+	}
+	if (Durability != Defaults->Durability)
+	{
+		SectionFlags |= SaveSection_Durability;
+	}
+	Writer.WriteByte(SectionFlags);
+
+	if (SectionFlags & SaveSection_Quality)
+	{
+		Writer.WriteByte(static_cast<uint8>(Quality));
+	}
+	if (SectionFlags & SaveSection_Durability)
+	{
+		Writer.WritePacked(static_cast<uint32>(FMath::Max(Durability, 0)));
+	}
+
+	Writer.WritePacked(ConceptSlots.Num());
+	for (int32 i = 0; i < ConceptSlots.Num(); ++i)
+	{
+		Writer.WriteSlot(ConceptSlots[i], MakeDefaultSlot(i));
+	}
+
+	Writer.Finish();
+	return true;
+}
+
+bool AConceptualObject::LoadObjectState(const TArray<uint8>& Data)
+{
+	const UConceptRegistry* Registry = UConceptRegistry::GetConceptRegistry(this);
+	FConceptSaveReader Reader(Data, Registry);
+	if (!Reader.ReadHeader())
+	{
+		return false;
+	}
+
+	const AConceptualObject* Defaults = GetDefault<AConceptualObject>(GetClass());
+	const uint8 SectionFlags = Reader.ReadByte();
+
+	const EObjectQuality LoadedQuality = (SectionFlags & SaveSection_Quality)
+		? static_cast<EObjectQuality>(FMath::Min<uint8>(Reader.ReadByte(), static_cast<uint8>(EObjectQuality::Legendary)))
+		: Defaults->Quality;
+	// Version 1 blobs capped durability to a byte
+	int32 LoadedDurability = Defaults->Durability;
+	if (SectionFlags & SaveSection_Durability)
+	{
+		LoadedDurability = Reader.GetVersion() >= static_cast<uint16>(ConceptSaveFormat::EVersion::PathTable)
+			? static_cast<int32>(FMath::Min<uint32>(Reader.ReadPacked(), MAX_int32))
+			: Reader.ReadByte();
+	}
+
+	// Default slots depend on quality, so apply it before decoding slots
+	const EObjectQuality PreviousQuality = Quality;
+	Quality = LoadedQuality;
+
+	TArray<FConceptSlot> LoadedSlots;
+	const uint32 SlotCount = Reader.ReadPacked();
+	for (uint32 i = 0; i < SlotCount && !Reader.IsError(); ++i)
+	{
+		FConceptSlot& Slot = LoadedSlots.Add_GetRef(MakeDefaultSlot(i));
+		Reader.ReadSlot(Slot);
+	}
+
+	if (Reader.IsError())
+	{
+		Quality = PreviousQuality;
+		UE_LOG(LogTemp, Warning, TEXT("LoadObjectState: Object state for %s is truncated or corrupt."), *GetName());
+		return false;
+	}
+
+	Durability = LoadedDurability;
+	ConceptSlots = MoveTemp(LoadedSlots);
+
+	if (Quality != PreviousQuality)
+	{
+		OnObjectQualityChanged.Broadcast(static_cast<int32>(Quality));
+	}
+
+	return true;
+}
@@ -82,6 +82,9 @@ public:
 	virtual float ApplyAttributeScaling(float BaseValue) const;
 
 protected:
+	// Open a concept-state snapshot for this activation's prediction key and wire it to the key's rejected/caught-up events
+	void BeginConceptPrediction(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo& ActivationInfo);
+
 	// Gameplay effects to apply when the ability is activated
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Concept Ability")
 	TArray<TSubclassOf<UGameplayEffect>> AbilityEffects;
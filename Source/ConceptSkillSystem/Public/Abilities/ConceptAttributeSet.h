@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
 #include "AbilitySystemComponent.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "ConceptAttributeSet.generated.h"
 
 // Uses macros from AttributeSet.h
@@ -22,6 +23,7 @@ FGameplayAttribute Get##PropertyName##Attribute() const \
 void Set##PropertyName(float NewVal) \
 { \
 	PropertyName.SetCurrentValue(NewVal); \
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, PropertyName, this); \
 }
 
 /**
@@ -45,6 +47,27 @@ public:
 	// Called before attribute change
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
 
+	// Called before base value change
+	virtual void PreAttributeBaseChange(const FGameplayAttribute& Attribute, float& NewValue) const override;
+
+	// Called after current value change, marks the attribute dirty for push-model replication
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+
+	// Called after base value change, marks the attribute dirty for push-model replication
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
+
+	// Snap low-precision attributes (observation, crafting, mastery) to coarse steps so small drifts don't trigger replication
+	UPROPERTY(EditDefaultsOnly, Category = "Replication")
+	bool bQuantizeLowPrecisionAttributes;
+
+	// Step used for ObservationRange when quantizing
+	UPROPERTY(EditDefaultsOnly, Category = "Replication", meta = (ClampMin = "0.0", EditCondition = "bQuantizeLowPrecisionAttributes"))
+	float RangeQuantizationStep;
+
+	// Step used for multiplier-style attributes when quantizing
+	UPROPERTY(EditDefaultsOnly, Category = "Replication", meta = (ClampMin = "0.0", EditCondition = "bQuantizeLowPrecisionAttributes"))
+	float MultiplierQuantizationStep;
+
 	// Concept-related attributes
 	// ConceptPower - Represents the overall power of concepts a character has mastered
 	UPROPERTY(BlueprintReadOnly, Category = "Concept Attributes", ReplicatedUsing = OnRep_ConceptPower)
@@ -82,6 +105,12 @@ public:
 	ATTRIBUTE_ACCESSORS(UConceptAttributeSet, CraftingProficiency)
 
 protected:
+	// Snap an attribute value to its quantization step, if quantization is enabled for it
+	void QuantizeAttributeValue(const FGameplayAttribute& Attribute, float& NewValue) const;
+
+	// Mark the replicated property backing an attribute dirty
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute) const;
+
 	// Replication callbacks
 	UFUNCTION()
 	virtual void OnRep_ConceptPower(const FGameplayAttributeData& OldConceptPower);
@@ -9,6 +9,7 @@
 /**
  * UConceptGameplayCue - Base class for concept-related gameplay cues
  * Provides visual and audio feedback for concept abilities and effects
+ * Client-only: the cue and the tier assets it references are left out of dedicated server cooks
  */
 UCLASS()
 class CONCEPTSKILLSYSTEM_API UConceptGameplayCue : public UGameplayCueNotify_Static
@@ -18,6 +19,10 @@ class CONCEPTSKILLSYSTEM_API UConceptGameplayCue : public UGameplayCueNotify_Sta
 public:
 	UConceptGameplayCue();
 
+	// Begin UObject
+	virtual bool NeedsLoadForServer() const override;
+	// End UObject
+
 	// Override to provide custom visual effects based on concept tier
 	virtual bool OnExecute_Implementation(AActor* MyTarget, const FGameplayCueParameters& Parameters) override;
 
@@ -30,6 +35,9 @@ public:
 	// Get the concept element from the gameplay cue parameters
 	FName GetConceptElementFromParameters(const FGameplayCueParameters& Parameters) const;
 
+	// Get how many executions were merged into this one by the skill manager's cue batching
+	int32 GetExecutionCount() const;
+
 protected:
 	// Different particle systems for different concept tiers
 	UPROPERTY(EditDefaultsOnly, Category = "Concept Gameplay Cue|VFX")
@@ -51,7 +59,7 @@ protected:
 	void SpawnParticleEffect(AActor* Target, UParticleSystem* ParticleSystem, FLinearColor Color);
 
 	// Spawn niagara effect at target location
-	void SpawnNiagaraEffect(AActor* Target, UNiagaraSystem* NiagaraSystem, FLinearColor Color);
+	void SpawnNiagaraEffect(AActor* Target, UNiagaraSystem* NiagaraSystem, FLinearColor Color, int32 ExecutionCount = 1);
 
 	// Play sound at target location
 	void PlaySoundEffect(AActor* Target, USoundBase* Sound);
@@ -20,7 +20,6 @@ public:
 	ABodyManual();
 
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
 
 	// The body part this manual can modify
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
@@ -7,6 +7,8 @@
 #include "Engine/DataAsset.h"
 #include "Concept.generated.h"
 
+class UTexture2D;
+
 UENUM(BlueprintType)
 enum class EConceptTier : uint8
 {
@@ -16,33 +18,50 @@ enum class EConceptTier : uint8
 	Abstract UMETA(DisplayName = "Abstract")
 };
 
+// Asset bundles concept data is split into; the registry loads Gameplay, UI requests UI on demand
+namespace ConceptAssetBundles
+{
+	extern CONCEPTSKILLSYSTEM_API const FName UI;
+	extern CONCEPTSKILLSYSTEM_API const FName Gameplay;
+}
+
+// Display-only data (names, descriptions, icons, cue assets) that dedicated servers never use
+namespace ConceptServerData
+{
+	// Whether an archive is writing a cooked package for a server-only target
+	CONCEPTSKILLSYSTEM_API bool IsCookingForServer(const FArchive& Ar);
+
+	// Bytes held by display-only text and icon references
+	CONCEPTSKILLSYSTEM_API SIZE_T GetDisplayDataSize(const FText& DisplayName, const FText& Description, const TSoftObjectPtr<UTexture2D>& Icon);
+}
+
 /**
  * UConcept - The fundamental unit of understanding and power in the world
  * Represents the inherent nature of objects, events, and abstract forces
  */
 UCLASS(BlueprintType)
-class CONCEPTSKILLSYSTEM_API UConcept : public UDataAsset
+class CONCEPTSKILLSYSTEM_API UConcept : public UPrimaryDataAsset
 {
 	GENERATED_BODY()
 
 public:
 	UConcept();
 
-	// The display name of the concept
+	// The display name of the concept; stripped from server cooks
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept")
 	FText DisplayName;
 
-	// Description of the concept
+	// Description of the concept; stripped from server cooks
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept", meta = (MultiLine = true))
 	FText Description;
 
 	// The tier of reality this concept belongs to
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept")
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept", AssetRegistrySearchable)
 	EConceptTier Tier;
 
-	// Icon representing the concept
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept")
-	UTexture2D* Icon;
+	// Icon representing the concept; only loaded with the UI bundle, stripped from server cooks
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept", meta = (AssetBundles = "UI"))
+	TSoftObjectPtr<UTexture2D> Icon;
 
 	// Gameplay tags associated with this concept
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept")
@@ -57,7 +76,7 @@ public:
 	int32 AcquisitionDifficulty;
 
 	// Related concepts that might be unlocked or discovered when this concept is acquired
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept")
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept", meta = (AssetBundles = "Gameplay"))
 	TArray<TSoftObjectPtr<UConcept>> RelatedConcepts;
 
 	// The chance (0-1) that observing this concept will lead to acquisition
@@ -66,4 +85,11 @@ public:
 
 	// Get the unique identifier for this concept
 	FPRIMARY_ASSET_ID GetPrimaryAssetId() const override;
+
+	// Begin UObject
+	virtual void Serialize(FArchive& Ar) override;
+	// End UObject
+
+	// Bytes of this concept that server cooks leave out
+	SIZE_T GetDisplayDataSize() const;
 };
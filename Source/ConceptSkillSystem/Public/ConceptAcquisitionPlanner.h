@@ -0,0 +1,216 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Concept.h"
+#include "ConceptSlot.h"
+#include "ConceptAcquisitionPlanner.generated.h"
+
+class UConceptComponent;
+class UConceptSkill;
+
+// One concept to acquire, in plan order
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptAcquisitionStep
+{
+	GENERATED_BODY()
+
+	// The concept to acquire
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	TSoftObjectPtr<UConcept> Concept;
+
+	// Body part of the free slot the concept should go into
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	EBodyPartType BodyPart = EBodyPartType::None;
+
+	// Max tier of that slot
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	EConceptTier SlotTier = EConceptTier::Physical;
+
+	// Estimated cost of acquiring the concept at this point of the plan
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	float Cost = 0.0f;
+
+	// Whether the concept is already observed or related to an acquired concept when this step is reached
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	bool bDiscovered = false;
+};
+
+// Cheapest order of acquisitions that gives a character every concept a skill requires
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptAcquisitionPlan
+{
+	GENERATED_BODY()
+
+	// The skill planned for
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	TSoftObjectPtr<UConceptSkill> TargetSkill;
+
+	// Concepts to acquire, in order; empty if the skill's concepts are already acquired
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	TArray<FConceptAcquisitionStep> Steps;
+
+	// Sum of the step costs
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	float TotalCost = 0.0f;
+
+	// Whether a plan was found; false if the free slots can't hold the required concepts or the search ran out of expansions
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	bool bFound = false;
+
+	// Search states expanded to find the plan
+	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
+	int32 Expansions = 0;
+};
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnAcquisitionPlanReady, const FConceptAcquisitionPlan&, Plan);
+
+/**
+ * UConceptAcquisitionPlanner - Plans the cheapest way for a character to acquire the concepts a skill requires
+ * Runs A* over sets of acquired concepts: acquiring a concept makes the concepts it relates to discoverable, which
+ * makes them cheaper to acquire, so detours through intermediate concepts can pay off. Each acquisition needs a free
+ * slot of a high enough tier. The problem is captured on the game thread, searched on a worker, and the plan is
+ * memoized until the concept catalog is replaced.
+ * The goal is every concept the skill's compiled requirement expression refers to outside a NOT. For plain AND
+ * expressions that is exact; an OR or N-of-M group is planned as if all its concepts were needed, and tag and NOT
+ * terms are left to the caller, so such plans are sufficient but not always the cheapest.
+ * Implements the "Dynamic Progression Through Mastery" design pillar
+ */
+UCLASS()
+class CONCEPTSKILLSYSTEM_API UConceptAcquisitionPlanner : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UConceptAcquisitionPlanner();
+
+	// Begin USubsystem
+	virtual void Deinitialize() override;
+	// End USubsystem
+
+	// Cost multiplier for acquiring a concept that is neither observed nor related to an acquired concept
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System", meta = (ClampMin = "1.0"))
+	float UndiscoveredCostScale;
+
+	// Upper bound on states a search expands before it gives up
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System", meta = (ClampMin = "1"))
+	int32 MaxExpansions;
+
+	// Upper bound on states a search keeps in memory; each expansion can add up to MaxCandidates of them
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System", meta = (ClampMin = "1"))
+	int32 MaxSearchNodes;
+
+	// Memoized plans kept before the memo is cleared
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System", meta = (ClampMin = "0"))
+	int32 MaxMemoizedPlans;
+
+	// Plan the acquisitions a component needs to unlock a skill; OnReady runs on the game thread, possibly right away if memoized
+	UFUNCTION(BlueprintCallable, Category = "Concept System")
+	void RequestPlan(UConceptComponent* Component, UConceptSkill* Skill, FOnAcquisitionPlanReady OnReady);
+
+	// Same as above for native callers
+	void RequestPlan(UConceptComponent* Component, UConceptSkill* Skill, TFunction<void(const FConceptAcquisitionPlan&)> OnReady);
+
+	// Number of searches running
+	int32 GetSearchesInFlight() const { return InFlight.Num(); }
+
+	// Drop every memoized plan
+	void ClearMemo();
+
+	// Get the planner for the game instance of a world context
+	UFUNCTION(BlueprintCallable, Category = "Concept System", meta = (WorldContext = "WorldContextObject"))
+	static UConceptAcquisitionPlanner* Get(const UObject* WorldContextObject);
+
+	// Candidate concepts per search, so a search state is a single uint64
+	static constexpr int32 MaxCandidates = 64;
+
+	/**
+	 * FProblem - Everything a search reads, captured on the game thread
+	 * Candidates are catalog concept indices; the first NumRequired are the missing requirements, the rest are
+	 * intermediates that lie between acquired concepts and a requirement in the RelatedConcepts graph.
+	 */
+	struct FProblem
+	{
+		// Candidate indices are only meaningful against the catalog they came from
+		uint32 CatalogVersion = 0;
+
+		int32 SkillIndex = INDEX_NONE;
+		TArray<int32, TInlineAllocator<MaxCandidates>> Candidates;
+		int32 NumRequired = 0;
+
+		// Per candidate: cost once discovered, tier, and candidates whose acquisition discovers it
+		TArray<float, TInlineAllocator<MaxCandidates>> Costs;
+		TArray<uint8, TInlineAllocator<MaxCandidates>> Tiers;
+		TArray<uint64, TInlineAllocator<MaxCandidates>> Enablers;
+
+		// Candidates discovered before anything is acquired
+		uint64 Discovered = 0;
+
+		// Free unlocked slots per max tier
+		int32 FreeSlots[4] = { 0, 0, 0, 0 };
+
+		float UndiscoveredCostScale = 1.0f;
+		int32 MaxExpansions = 0;
+		int32 MaxNodes = 0;
+
+		bool operator==(const FProblem& Other) const;
+		friend uint32 GetTypeHash(const FProblem& Problem);
+	};
+
+	// Run the search; any thread. OutOrder receives candidate positions in acquisition order.
+	static void Search(const FProblem& Problem, TArray<int32>& OutOrder, float& OutTotalCost, int32& OutExpansions, bool& bOutFound);
+
+private:
+	typedef TFunction<void(const FConceptAcquisitionPlan&)> FPlanCallback;
+
+	// A free slot a planned concept may go into
+	struct FFreeSlot
+	{
+		EBodyPartType BodyPart;
+		EConceptTier MaxTier;
+	};
+
+	// Outcome of a search; slots are assigned per requester, whose body parts may differ
+	struct FSearchResult
+	{
+		TSoftObjectPtr<UConceptSkill> Skill;
+
+		// Concept of each candidate
+		TArray<TSoftObjectPtr<UConcept>> Concepts;
+
+		TArray<int32> Order;
+		float TotalCost = 0.0f;
+		int32 Expansions = 0;
+		bool bFound = false;
+	};
+
+	// A caller waiting for a running search
+	struct FWaiter
+	{
+		FPlanCallback Callback;
+		TArray<FFreeSlot> FreeSlots;
+	};
+
+	// Capture the search problem for a component and skill; false if the skill isn't in the catalog
+	bool BuildProblem(UConceptComponent* Component, UConceptSkill* Skill, FProblem& OutProblem, FSearchResult& OutResult, TArray<FFreeSlot>& OutFreeSlots) const;
+
+	// Turn a search result into a plan, assigning each step one of the requester's free slots
+	static FConceptAcquisitionPlan MakePlan(const FProblem& Problem, const FSearchResult& Result, const TArray<FFreeSlot>& FreeSlots);
+
+	// Memoize a finished search and answer everyone waiting for it
+	void FinishSearch(const FProblem& Problem, const FSearchResult& Result);
+
+	// Forget memoized plans when the catalog they were planned against has been replaced
+	void SyncCatalogVersion();
+
+	// Catalog version the memo belongs to
+	uint32 MemoCatalogVersion;
+
+	// Finished searches by problem
+	TMap<FProblem, FSearchResult> Memo;
+
+	// Callers waiting for running searches, by problem, so identical requests share one search
+	TMap<FProblem, TArray<FWaiter>> InFlight;
+};
@@ -0,0 +1,187 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Concept.h"
+#include "ConceptSkill.h"
+
+class FConceptCatalogFile;
+
+// Data of one concept or skill asset, captured on the game thread so catalogs can be built off it
+struct FConceptCatalogAssetRecord
+{
+	FSoftObjectPath Path;
+
+	// Tier of a concept, or manifestation type of a skill
+	uint8 Bucket = 0;
+
+	// RelatedConcepts of a concept, or RequiredConcepts of a skill
+	TArray<FSoftObjectPath> Links;
+};
+
+// Assets added, changed or removed since a catalog was built
+struct CONCEPTSKILLSYSTEM_API FConceptCatalogDelta
+{
+	TArray<FConceptCatalogAssetRecord> Concepts;
+	TArray<FConceptCatalogAssetRecord> Skills;
+	TArray<FSoftObjectPath> Removed;
+
+	bool IsEmpty() const { return Concepts.Num() == 0 && Skills.Num() == 0 && Removed.Num() == 0; }
+
+	// Fold a later delta into this one; the later state of each asset wins
+	void Append(FConceptCatalogDelta&& Other);
+};
+
+/**
+ * FConceptCatalog - Immutable index of every concept and skill asset
+ * Built once per process and shared by every game instance's UConceptRegistry (multi-client PIE, multi-instance servers).
+ * Never modified after it is published: asset edits build a new catalog off the game thread, re-indexing only the
+ * changed assets, and publish it with an atomic pointer swap. A replaced catalog is freed once its frame has ended and
+ * no GetShared reference to it is left, so a Get reference taken earlier in the frame stays valid; other threads, and
+ * game-thread work that outlives the frame, hold a GetShared reference instead.
+ * Dense indices and Hash are only meaningful within one catalog: a refresh that adds or removes assets shifts them.
+ * Nothing persistent stores them; saves write concept paths and resolve them against whatever catalog is loaded.
+ * Cooked builds read the precomputed indexes from a memory-mapped FConceptCatalogFile; editor builds scan the asset registry.
+ * Implements the "Dynamic Progression Through Mastery" design pillar
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptCatalog
+{
+	// Assigns the next Version
+	FConceptCatalog();
+
+	// Views may point into this catalog's own storage, so it is never copied
+	FConceptCatalog(const FConceptCatalog&) = delete;
+	FConceptCatalog& operator=(const FConceptCatalog&) = delete;
+
+	// Every concept, sorted by path; the position is the dense concept index within this catalog
+	TArray<TSoftObjectPtr<UConcept>> Concepts;
+
+	// Every skill, sorted by path; the position is the dense skill index
+	TArray<TSoftObjectPtr<UConceptSkill>> Skills;
+
+	// Concepts organized by tier
+	TMap<EConceptTier, TArray<TSoftObjectPtr<UConcept>>> ConceptsByTier;
+
+	// Skills organized by manifestation type
+	TMap<ESkillManifestationType, TArray<TSoftObjectPtr<UConceptSkill>>> SkillsByType;
+
+	// Tier of each concept and manifestation type of each skill, by dense index
+	TArray<uint8> ConceptTiers;
+	TArray<uint8> SkillTypes;
+
+	// Hash of the sorted concept paths
+	uint32 Hash = 0;
+
+	// Unique per catalog built in this process, so results derived from a catalog can tell when it was replaced
+	uint32 Version;
+
+	// uint64 words per skill requirement mask
+	int32 MaskWords = 0;
+
+	// Skill requirement masks, MaskWords per skill
+	TConstArrayView<uint64> RequirementMasks;
+
+	// RelatedConcepts adjacency as compressed sparse rows: concept C links to Related[RelatedStarts[C], RelatedStarts[C + 1])
+	TConstArrayView<uint32> RelatedStarts;
+	TConstArrayView<uint32> Related;
+
+	// Strongly connected component of each concept in the RelatedConcepts graph (see FConceptGraph)
+	TArray<int32> ConceptComponents;
+
+	// Whether each component contains a cycle
+	TArray<bool> CyclicComponents;
+
+	// Per tier, a bitset over concepts: bit C is set if concept C leads to a concept of that tier, MaskWords per tier
+	TArray<uint64> TierReachMasks;
+
+	// Dense index of a concept or skill (INDEX_NONE if not in the catalog)
+	int32 GetConceptIndex(const FSoftObjectPath& Path) const;
+	int32 GetSkillIndex(const FSoftObjectPath& Path) const;
+
+	// Requirement mask of a skill: bit C is set if the skill requires concept C
+	TConstArrayView<uint64> GetRequirementMask(int32 SkillIndex) const { return RequirementMasks.Slice(SkillIndex * MaskWords, MaskWords); }
+
+	// Dense indices of the concepts a concept lists as related
+	TConstArrayView<uint32> GetRelatedConcepts(int32 ConceptIndex) const { return Related.Slice(RelatedStarts[ConceptIndex], RelatedStarts[ConceptIndex + 1] - RelatedStarts[ConceptIndex]); }
+
+	// Concepts that lead to a tier, as a bitset over concept indices
+	TConstArrayView<uint64> GetTierReachMask(EConceptTier Tier) const { return TConstArrayView<uint64>(TierReachMasks).Slice(static_cast<int32>(Tier) * MaskWords, MaskWords); }
+
+	// Whether the indexes came from a cooked catalog file
+	bool IsCooked() const { return File.IsValid(); }
+
+	// The published catalog, built on first use; game thread only, and not to be held across frames
+	static const FConceptCatalog& Get();
+
+	// The published catalog without building one (an empty catalog if none is); game thread only
+	static const FConceptCatalog& GetPublished();
+
+	// A reference that keeps the published catalog alive however long it is held; callable from any thread
+	static TSharedRef<const FConceptCatalog, ESPMode::ThreadSafe> GetShared();
+
+	// Rescan every asset now and publish the result
+	static void Rebuild();
+
+	// Re-index changed, added or removed assets off the game thread and publish when done
+	static void QueueRefresh(const TArray<FSoftObjectPath>& ChangedAssets, const TArray<FSoftObjectPath>& RemovedAssets);
+
+	// Whether a queued refresh has not been published yet
+	static bool IsRefreshPending();
+
+	// Drop the published and retired catalogs (module shutdown)
+	static void Release();
+
+	// Scan the asset registry, load the Gameplay bundles and build every index (what the cook step writes out)
+	static TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> BuildFromAssetRegistry();
+
+	// Take the indexes from a mapped catalog file and load the Gameplay bundles of the assets it lists
+	static TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> BuildFromFile(const TSharedRef<FConceptCatalogFile, ESPMode::ThreadSafe>& InFile);
+
+	// Build a catalog from a previous one plus a delta without touching UObjects, so it can run on any thread;
+	// assets the delta doesn't mention keep their tiers, masks and links, remapped if indices shifted
+	static TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> BuildFromDelta(const FConceptCatalog* Previous, const FConceptCatalogDelta& Delta);
+
+private:
+	// Cooked catalog file, or the asset registry scan if there is none or this is an editor build
+	static TSharedRef<FConceptCatalog, ESPMode::ThreadSafe> Build();
+
+	// Every concept and skill asset the asset registry knows about
+	static void GatherCatalogAssets(TArray<FSoftObjectPath>& OutPaths, TArray<FPrimaryAssetId>& OutAssetIds);
+
+	// Swap in a new catalog and retire the old one
+	static void Publish(TSharedRef<const FConceptCatalog, ESPMode::ThreadSafe> NewCatalog);
+
+	// Start the off-thread build of the pending delta, if none is running
+	static void StartPendingBuild();
+
+	// Free the replaced catalogs nothing references any more; keeps ticking while some are still held
+	static bool ReclaimRetired(float DeltaTime);
+
+	// Load catalog assets with only the Gameplay bundle; assets the asset manager doesn't scan are loaded directly
+	static void LoadCatalogAssets(const TArray<FSoftObjectPath>& Paths, const TArray<FPrimaryAssetId>& AssetIds);
+
+	// Capture a loaded concept or skill into a delta; false if the path is neither
+	static bool CaptureRecord(const FSoftObjectPath& Path, FConceptCatalogDelta& OutDelta);
+
+	// Fill the SCC and tier reachability indexes from the related-concept graph
+	void BuildReachability();
+
+#if WITH_EDITOR
+	// Queue refreshes when concept or skill assets are edited, reimported, added, renamed or deleted
+	static void StartWatchingAssets();
+	static void StopWatchingAssets();
+#endif
+
+	// Index by path (scanned catalogs; cooked ones look paths up in the file)
+	TMap<FSoftObjectPath, int32> ConceptIndexByPath;
+	TMap<FSoftObjectPath, int32> SkillIndexByPath;
+
+	// Storage behind the views when the catalog was scanned
+	TArray<uint64> RequirementMaskStorage;
+	TArray<uint32> RelatedStartStorage;
+	TArray<uint32> RelatedStorage;
+
+	// Mapped file behind the views when the catalog was cooked
+	TSharedPtr<FConceptCatalogFile, ESPMode::ThreadSafe> File;
+};
@@ -0,0 +1,30 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ConceptCatalogCommandlet.generated.h"
+
+/**
+ * UConceptCatalogCommandlet - Cook step that writes the concept catalog as one memory-mappable file
+ * Run before staging: UnrealEditor-Cmd <Project> -run=ConceptCatalog [-Output=<File>]
+ * Then, once the cook has finished, check the file against the cooked content so a stale catalog fails the build
+ * instead of every startup: -run=ConceptCatalog -VerifyCooked=<Cooked>/<Project>/Metadata/DevelopmentAssetRegistry.bin
+ */
+UCLASS()
+class CONCEPTSKILLSYSTEM_API UConceptCatalogCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UConceptCatalogCommandlet();
+
+	// Begin UCommandlet
+	virtual int32 Main(const FString& Params) override;
+	// End UCommandlet
+
+private:
+	// Compare the catalog file with the concepts and skills in a cooked asset registry; 0 if they match
+	int32 VerifyCooked(const FString& CatalogPath, const FString& RegistryPath) const;
+};
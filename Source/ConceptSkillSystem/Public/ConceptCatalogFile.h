@@ -0,0 +1,153 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FConceptCatalog;
+
+/**
+ * Cooked concept catalog file layout. Every section is a flat array at an 8-byte aligned offset from the start of
+ * the file, so the runtime maps the file and reads it in place. Written in the byte order of the cooking machine, which
+ * ByteOrderMark records; a file from a machine of the other byte order is rejected rather than read swapped.
+ *   Header | Concepts | Skills | TierStarts | TierConcepts | TypeStarts | TypeSkills | RequirementMasks
+ *          | RelatedStarts | Related | ConceptNames | SkillNames | Strings
+ */
+struct FConceptCatalogFileHeader
+{
+	uint32 Magic;
+	uint32 Version;
+
+	// ConceptCatalogFile::ByteOrderMark as the writer stored it
+	uint32 ByteOrderMark;
+
+	// Same as FConceptCatalog::Hash, so saves stay valid between scanned and cooked catalogs
+	uint32 CatalogHash;
+
+	uint32 NumConcepts;
+	uint32 NumSkills;
+	uint32 NumTiers;
+	uint32 NumTypes;
+
+	// uint64 words per skill requirement mask
+	uint32 MaskWords;
+
+	// Number of RelatedConcepts edges
+	uint32 NumRelated;
+
+	// FConceptCatalogFileEntry[NumConcepts], sorted by path; the position is the dense concept ID
+	uint32 ConceptsOffset;
+
+	// FConceptCatalogFileEntry[NumSkills], sorted by path; the position is the dense skill ID
+	uint32 SkillsOffset;
+
+	// uint32[NumTiers + 1]: the concepts of tier T are TierConcepts[TierStarts[T], TierStarts[T + 1])
+	uint32 TierStartsOffset;
+	uint32 TierConceptsOffset;
+
+	// uint32[NumTypes + 1]: the skills of type T are TypeSkills[TypeStarts[T], TypeStarts[T + 1])
+	uint32 TypeStartsOffset;
+	uint32 TypeSkillsOffset;
+
+	// uint64[NumSkills * MaskWords]: bit C of a skill's mask is set if it requires concept C
+	uint32 RequirementMasksOffset;
+
+	// uint32[NumConcepts + 1] and uint32[NumRelated]: RelatedConcepts adjacency, compressed sparse rows
+	uint32 RelatedStartsOffset;
+	uint32 RelatedOffset;
+
+	// FConceptCatalogFileName[NumConcepts] and [NumSkills], sorted by name hash
+	uint32 ConceptNamesOffset;
+	uint32 SkillNamesOffset;
+
+	// UTF-8 asset paths
+	uint32 StringsOffset;
+	uint32 StringsSize;
+
+	// Total size, checked against the mapped size
+	uint32 FileSize;
+};
+
+// A concept or skill: where its path is, and its tier or manifestation type
+struct FConceptCatalogFileEntry
+{
+	uint32 PathOffset;
+	uint32 PathLength;
+	uint32 NameHash;
+	uint32 Bucket;
+};
+
+// Name hash lookup entry
+struct FConceptCatalogFileName
+{
+	uint32 NameHash;
+	uint32 Index;
+};
+
+/**
+ * FConceptCatalogFile - A cooked concept catalog, memory-mapped and read in place
+ * Written by UConceptCatalogCommandlet; FConceptCatalog uses it instead of the asset registry scan in cooked builds
+ */
+class CONCEPTSKILLSYSTEM_API FConceptCatalogFile
+{
+public:
+	~FConceptCatalogFile();
+
+	// Map a catalog file; null if it is missing or not a valid catalog of this version
+	static TSharedPtr<FConceptCatalogFile, ESPMode::ThreadSafe> Map(const FString& Filename);
+
+	// Serialize a catalog into the file layout
+	static void Write(const FConceptCatalog& Catalog, TArray<uint8>& OutData);
+
+	// Where the cook step writes the catalog and the runtime looks for it
+	static FString GetDefaultPath();
+
+	// Hash of an asset name as stored in the name tables (case-insensitive)
+	static uint32 HashName(const FString& AssetName);
+
+	const FConceptCatalogFileHeader& GetHeader() const { return *reinterpret_cast<const FConceptCatalogFileHeader*>(Data); }
+
+	TConstArrayView<FConceptCatalogFileEntry> GetConcepts() const { return Section<FConceptCatalogFileEntry>(GetHeader().ConceptsOffset, GetHeader().NumConcepts); }
+	TConstArrayView<FConceptCatalogFileEntry> GetSkills() const { return Section<FConceptCatalogFileEntry>(GetHeader().SkillsOffset, GetHeader().NumSkills); }
+	TConstArrayView<uint32> GetTierStarts() const { return Section<uint32>(GetHeader().TierStartsOffset, GetHeader().NumTiers + 1); }
+	TConstArrayView<uint32> GetTierConcepts() const { return Section<uint32>(GetHeader().TierConceptsOffset, GetHeader().NumConcepts); }
+	TConstArrayView<uint32> GetTypeStarts() const { return Section<uint32>(GetHeader().TypeStartsOffset, GetHeader().NumTypes + 1); }
+	TConstArrayView<uint32> GetTypeSkills() const { return Section<uint32>(GetHeader().TypeSkillsOffset, GetHeader().NumSkills); }
+	TConstArrayView<uint64> GetRequirementMasks() const { return Section<uint64>(GetHeader().RequirementMasksOffset, GetHeader().NumSkills * GetHeader().MaskWords); }
+	TConstArrayView<uint32> GetRelatedStarts() const { return Section<uint32>(GetHeader().RelatedStartsOffset, GetHeader().NumConcepts + 1); }
+	TConstArrayView<uint32> GetRelated() const { return Section<uint32>(GetHeader().RelatedOffset, GetHeader().NumRelated); }
+
+	// Asset path of an entry
+	FSoftObjectPath GetPath(const FConceptCatalogFileEntry& Entry) const;
+
+	// Dense ID of a concept or skill by path (INDEX_NONE if not in the file)
+	int32 FindConcept(const FSoftObjectPath& Path) const;
+	int32 FindSkill(const FSoftObjectPath& Path) const;
+
+	// Whether the file lists exactly these concept and skill assets, i.e. it was not cooked from older content (cook-time check)
+	bool MatchesAssets(TConstArrayView<FSoftObjectPath> AssetPaths) const;
+
+private:
+	FConceptCatalogFile() = default;
+
+	// Whether every section lies inside the mapped bytes and every index and offset table in them is consistent
+	bool Validate() const;
+
+	// Binary search a name table, then compare paths to rule out hash collisions
+	int32 Find(TConstArrayView<FConceptCatalogFileName> Names, TConstArrayView<FConceptCatalogFileEntry> Entries, const FSoftObjectPath& Path) const;
+
+	template<typename T>
+	TConstArrayView<T> Section(uint32 Offset, uint32 Num) const
+	{
+		return TConstArrayView<T>(reinterpret_cast<const T*>(Data + Offset), Num);
+	}
+
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+
+	// The mapped file
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+};
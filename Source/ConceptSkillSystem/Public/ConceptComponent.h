@@ -6,13 +6,21 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 #include "ConceptSlot.h"
+#include "ConceptKnowledge.h"
+#include "ConceptStateSnapshot.h"
 #include "Concept.h"
+#include "ConceptGrammarValidator.h"
 #include "AbilitySystemInterface.h"
 #include "ConceptComponent.generated.h"
 
+class IConceptJournal;
+struct FConceptJournalRecord;
+class AConceptualObject;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnConceptAcquired, UConcept*, Concept, FConceptSlot, Slot);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnConceptMasteryChanged, UConcept*, Concept, int32, NewMasteryLevel);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSlotUnlocked, FConceptSlot, UnlockedSlot);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPublicSummaryChanged, const FConceptPublicSummary&, Summary);
 
 /**
  * UConceptComponent - Component that manages a character's concept slots and abilities
@@ -26,25 +34,46 @@ class CONCEPTSKILLSYSTEM_API UConceptComponent : public UActorComponent, public
 public:
 	UConceptComponent();
 
+	// Begin UObject
+	virtual void PostInitProperties() override;
+	// End UObject
+
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	// IAbilitySystemInterface
 	virtual class UAbilitySystemComponent* GetAbilitySystemComponent() const override;
 
-	// The slots for each body part
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
-	TMap<EBodyPartType, TArray<FConceptSlot>> BodyPartSlots;
+	// The slots for every body part, delta-replicated per slot to the owning client only (Blueprints read them through GetAllSlots)
+	UPROPERTY(Replicated, VisibleInstanceOnly, Category = "Concept System")
+	FConceptSlotContainer Slots;
+
+	// Observed/acquired state per concept, delta-replicated to the owning client only
+	UPROPERTY(Replicated)
+	FConceptKnowledgeContainer Knowledge;
+
+	// Coarse summary of slotted concepts, replicated to everyone except the owner
+	UPROPERTY(ReplicatedUsing = OnRep_PublicSummary, BlueprintReadOnly, Category = "Concept System")
+	FConceptPublicSummary PublicSummary;
+
+	// How often (seconds) the server refreshes the public summary when it has changed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System|Replication", meta = (ClampMin = "0.05"))
+	float SummaryUpdateInterval;
+
+	// Maximum number of synergies exposed in the public summary
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System|Replication", meta = (ClampMin = "0"))
+	int32 MaxPublicSynergies;
 
 	// The maximum number of slots per body part (can be increased through progression)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
 	TMap<EBodyPartType, int32> MaxSlotsPerBodyPart;
 
-	// The concepts that this character has observed but not yet acquired
+	// The concepts that this character has observed but not yet acquired (mirrored to the owner through Knowledge)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
 	TSet<TSoftObjectPtr<UConcept>> ObservedConcepts;
 
-	// The concepts that this character has fully acquired
+	// The concepts that this character has fully acquired (mirrored to the owner through Knowledge)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
 	TSet<TSoftObjectPtr<UConcept>> AcquiredConcepts;
 
@@ -52,6 +81,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
 	TMap<EBodyPartType, FCoreNodeSlot> CoreNodeSlots;
 
+	// Width of the slot grid used to assign slot coordinates
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System", meta = (ClampMin = "1"))
+	int32 GridWidth;
+
+	// Height of the slot grid
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System", meta = (ClampMin = "1"))
+	int32 GridHeight;
+
+	// Rules by which adjacent slotted concepts link (no grammar checks nothing)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
+	UConceptGrammar* Grammar;
+
 	// Delegates
 	UPROPERTY(BlueprintAssignable, Category = "Concept System")
 	FOnConceptAcquired OnConceptAcquired;
@@ -62,6 +103,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Concept System")
 	FOnSlotUnlocked OnSlotUnlocked;
 
+	UPROPERTY(BlueprintAssignable, Category = "Concept System")
+	FOnPublicSummaryChanged OnPublicSummaryChanged;
+
 	// Observe a concept in the world, potentially leading to acquisition
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	bool ObserveConcept(UConcept* Concept, float ObservationQuality = 1.0f);
@@ -82,6 +126,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	TArray<FConceptSlot> GetSlotsForBodyPart(EBodyPartType BodyPart) const;
 
+	// Get copies of the slots for every body part
+	UFUNCTION(BlueprintPure, Category = "Concept System")
+	TArray<FConceptSlot> GetAllSlots() const;
+
+	// Get the highest mastery level of a concept across all slots (0 if not held)
+	UFUNCTION(BlueprintCallable, Category = "Concept System")
+	int32 GetHighestMasteryLevel(UConcept* Concept) const;
+
 	// Find the first empty slot in a body part that can hold the given concept
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	bool FindEmptySlotForConcept(UConcept* Concept, EBodyPartType BodyPart, FConceptSlot& OutSlot);
@@ -136,32 +188,237 @@ public:
 	};
 
 	// Properties for progression mechanics
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Progression")
+	UPROPERTY(ReplicatedUsing = OnRep_ProgressionPool, EditAnywhere, BlueprintReadWrite, Category = "Progression")
 	float ProgressionPool;  // Current pool of progression points
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Progression", meta = (ClampMin = "0", UIMin = "0"))
 	float ProgressionCostToUnlockSlot;  // Cost in progression points to unlock a new slot, default can be set in editor
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept Manifestation")
+	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = "Concept Manifestation")
 	TArray<FMediatedSkill> MediatedSkills;
 
 	// New functions for gaining progression and modified UnlockConceptSlot
 	UFUNCTION(BlueprintCallable, Category = "Progression")
 	void GainProgression(float Amount);  // Gain progression points from mundane activities
 
-	// Modify UnlockConceptSlot to require progression
+	// Write slots, knowledge, mediated skills, progression and core nodes to a compact binary blob
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Save")
+	bool SaveConceptState(TArray<uint8>& OutData) const;
+
+	// Restore state written by SaveConceptState (authority only); concepts are matched by asset path, so catalog changes only drop removed concepts
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Save")
+	bool LoadConceptState(const TArray<uint8>& Data);
+
+	// Number of journal records after which the journal is folded into a snapshot (0 = never)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System|Save", meta = (ClampMin = "0"))
+	int32 JournalCompactionThreshold;
+
+	// Attach a file journal under Saved/ConceptJournal and restore state from it (authority only); detached again if it cannot be restored
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Save")
+	bool EnableFileJournal(const FString& JournalKey);
+
+	// Load the journal's snapshot and replay the records appended after it
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Save")
+	bool RestoreFromJournal();
+
+	// Fold every journaled mutation into a new snapshot
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Save")
+	bool CompactJournal();
+
+	// Attach a journal that records every concept-state mutation (nullptr to detach)
+	void SetJournal(TSharedPtr<IConceptJournal> InJournal);
+
+	// Forge an acquired concept into a conceptual object
+	UFUNCTION(BlueprintCallable, Category = "Concept Manifestation")
+	bool ForgeConcept(AConceptualObject* Object, UConcept* Concept);
+
+	// Open a rollback snapshot for a predicted activation; closed by RestoreSnapshot (rejected) or CommitSnapshot (caught up)
+	void BeginPredictionSnapshot(int32 PredictionKey);
+
+	// Open a rollback snapshot for a "what-if" preview. Until it closes, mutations skip the journal, delegates,
+	// ability level updates, the public summary and replication. Prefer FConceptPreviewScope.
+	int32 BeginPreviewSnapshot();
+
+	// Whether a preview snapshot is open, so changes are about to be undone
+	bool IsPreviewing() const { return PreviewDepth > 0; }
+
+	// The ability system's owned tags plus any an open preview added, for requirement checks made during a preview
+	const FGameplayTagContainer& GetEffectiveOwnedTags() const;
+
+	// Undo every change made since the snapshot opened; snapshots opened after it are discarded too
+	bool RestoreSnapshot(int32 Key);
+
+	// Keep the changes made since the snapshot opened and stop tracking them
+	void CommitSnapshot(int32 Key);
+
+	// Build the public summary from the current slot state
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
-	bool UnlockConceptSlot(EBodyPartType BodyPart, EConceptTier MaxTier = EConceptTier::Physical);  // Now checks and consumes progression
+	FConceptPublicSummary BuildPublicSummary();
+
+	// Check the grammar of the chains of adjacent concepts in a body part's slot grid; only chains whose slots
+	// changed since the last check are scanned again
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Grammar")
+	FConceptGrammarReport ValidateGrammar(EBodyPartType BodyPart);
+
+	// Check the grammar of a body part's slots read in order, each run of filled slots as one sequence
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Grammar")
+	FConceptGrammarReport ValidateSlotSequence(EBodyPartType BodyPart);
+
+	// Called on clients when a slot is added or changed by replication
+	void HandleReplicatedSlotChanged(const FConceptSlot& Slot);
+
+	// Called on the owning client when a knowledge entry is added or changed by replication
+	void HandleReplicatedKnowledgeChanged(const FConceptKnowledgeEntry& Entry);
+
+	// Called on the owning client before replication removes a knowledge entry
+	void HandleReplicatedKnowledgeRemoved(const FConceptKnowledgeEntry& Entry);
 
 private:
+	// Drives the public summary rebuild
+	friend class UConceptSystemSubsystem;
+
 	// Initialize slots for all body parts
 	void InitializeSlots();
 
+	// Build the slot InitializeSlots creates at an index within a body part
+	FConceptSlot MakeDefaultSlot(EBodyPartType BodyPart, int32 Index) const;
+
+	// Add the tier, concept and body part tags for a held concept to the ability system
+	void ApplyConceptTags(UConcept* Concept, EBodyPartType BodyPart);
+
+	// The tier, concept and body part tags a held concept grants
+	static FGameplayTagContainer GetConceptTags(const UConcept* Concept, EBodyPartType BodyPart);
+
+	// The tag a mediated skill grants (invalid if no such tag is registered)
+	static FGameplayTag GetMediatedSkillTag(const FMediatedSkill& Skill);
+
+	// Add or remove the loose tags granted by every held concept and mediated skill, as when swapping in loaded state
+	void ApplyStateTags();
+	void RemoveStateTags();
+
+	// Generate the description shown for a mediated skill
+	static FString BuildMediatedSkillDescription(const TArray<UConcept*>& Concepts, bool bIsActiveSkill);
+
+	// Stamp a record with the next sequence number and append it to the journal
+	void RecordJournal(FConceptJournalRecord& Record);
+
+	// Apply a journaled mutation directly to the runtime state
+	void ApplyJournalRecord(const FConceptJournalRecord& Record);
+
+	// Index of a slot in the slot container (used to address slots in the journal)
+	int32 GetSlotIndex(const FConceptSlot& Slot) const;
+
+	// Open a snapshot with the given key
+	void OpenSnapshot(int32 Key);
+
+	// Discard the snapshot at FirstIndex and every snapshot opened after it
+	void CloseSnapshots(int32 FirstIndex);
+
+	// Index of the open snapshot with the given key, or INDEX_NONE
+	int32 FindSnapshot(int32 Key) const;
+
+	// Save a slot's fields into every open snapshot that hasn't seen it change yet
+	void TouchSlot(const FConceptSlot& Slot);
+
+	// Save the progression pool into every open snapshot that hasn't seen it change yet
+	void TouchProgression();
+
+	// Mark a slot for replication, unless the change is a preview, and for the next grammar sync either way
+	void MarkSlotDirty(FConceptSlot& Slot);
+
+	// Update ability levels from mastery, unless the change is a preview
+	void RefreshAbilityLevels();
+
+	// Grant state tags: loose tags on the ability system, or the preview scratch tags while previewing
+	void AddStateTags(const FGameplayTagContainer& Tags);
+
+	// Record set additions and loose tags so open snapshots can undo them
+	void NoteObserved(UConcept* Concept);
+	void NoteAcquired(UConcept* Concept);
+	void NoteTagsAdded(const FGameplayTagContainer& Tags);
+
+	UFUNCTION()
+	void OnRep_ProgressionPool();
+
+	// Open rollback snapshots, oldest first
+	TArray<FConceptStateSnapshot> OpenSnapshots;
+
+	// Key for the next preview snapshot
+	int32 NextPreviewKey;
+
+	// Number of open preview snapshots
+	int32 PreviewDepth;
+
+	// Tags granted while previewing, one entry per grant; kept off the ability system so nothing live or replicated sees them
+	TArray<FGameplayTag> PreviewTags;
+
+	// Skills mediated while previewing, kept out of the replicated MediatedSkills
+	TArray<FMediatedSkill> PreviewMediatedSkills;
+
+	// Owned tags merged with PreviewTags, rebuilt by GetEffectiveOwnedTags
+	mutable FGameplayTagContainer PreviewOwnedTags;
+
+	// The journal mutations are recorded to, if any
+	TSharedPtr<IConceptJournal> Journal;
+
+	// Sequence number for the next journal record
+	uint32 NextJournalSequence;
+
+	// Records appended since the last compaction
+	int32 RecordsSinceCompaction;
+
+	// Set while replaying so replayed mutations aren't journaled again
+	bool bReplayingJournal;
+
+	// Optional sections of the saved concept state
+	enum ESaveSection : uint8
+	{
+		SaveSection_Progression = 1 << 0,
+		SaveSection_CoreNodes = 1 << 1
+	};
+
 	// Find a slot by its unique ID
-	bool FindSlotById(const FGuid& SlotId, FConceptSlot& OutSlot, EBodyPartType& OutBodyPart);
+	FConceptSlot* FindSlotById(const FGuid& SlotId);
+
+	// Find the first empty, unlocked slot in a body part that can hold the given concept
+	FConceptSlot* FindEmptySlot(UConcept* Concept, EBodyPartType BodyPart);
+
+	// Flag the public summary for rebuild on the next summary update
+	void MarkPublicSummaryDirty();
+
+	// Rebuild and publish the public summary if it has changed (authority only)
+	void UpdatePublicSummary();
+
+	UFUNCTION()
+	void OnRep_PublicSummary();
+
+	// Whether slot state changed since the public summary was last built
+	bool bPublicSummaryDirty;
+
+	// A body part's slot grid as last checked against the grammar
+	struct FGrammarGrid
+	{
+		FConceptGrammarValidator Validator;
+
+		// The grammar and compile the validator was reset for; weak, so a grammar unloaded meanwhile forces a reset
+		TWeakObjectPtr<const UConceptGrammar> Grammar;
+		uint32 CompileVersion = 0;
+
+		// Cell each slot was last written to (INDEX_NONE if none), by slot index
+		TArray<int32> CellBySlot;
+
+		// Slots changed since the last sync
+		TSet<int32> DirtySlots;
+	};
+
+	// Bring a body part's grid up to date with the slots changed since its last sync, or nullptr without a grammar
+	FConceptGrammarValidator* SyncGrammarGrid(EBodyPartType BodyPart);
+
+	// Queue a slot for the next sync of every grammar grid
+	void MarkGrammarSlotDirty(int32 SlotIndex);
 
-	// Update a slot in the body part slots map
-	void UpdateSlot(const FConceptSlot& Slot, EBodyPartType BodyPart);
+	// Grammar grids by body part, synced lazily by ValidateGrammar
+	TMap<EBodyPartType, FGrammarGrid> GrammarGrids;
 
 	// The ability system component associated with this actor
 	UPROPERTY()
@@ -0,0 +1,70 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FConceptCooldownWheel - Hierarchical timing wheel for many small keyed cooldowns
+ * Checks are a single hash lookup; expiry costs O(1) amortized per cooldown and needs no per-owner tick.
+ * Only active cooldowns take memory.
+ */
+class CONCEPTSKILLSYSTEM_API FConceptCooldownWheel
+{
+public:
+	explicit FConceptCooldownWheel(float InResolution = 0.25f);
+
+	// Start (or restart) a cooldown
+	void Add(uint64 Key, float Duration);
+
+	// Whether a cooldown is still running
+	bool IsActive(uint64 Key) const { return Deadlines.Contains(Key); }
+
+	// Seconds left on a cooldown (0 if not active)
+	float GetRemaining(uint64 Key) const;
+
+	// Advance time and expire every cooldown that has run out
+	void Advance(float DeltaTime);
+
+	// Number of active cooldowns
+	int32 Num() const { return Deadlines.Num(); }
+
+	// Drop every cooldown
+	void Reset();
+
+	// Combine two object IDs into a cooldown key
+	static uint64 MakeKey(uint32 A, uint32 B) { return (static_cast<uint64>(A) << 32) | B; }
+
+private:
+	struct FEntry
+	{
+		uint64 Key;
+		uint64 DeadlineTick;
+	};
+
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+	static constexpr uint64 SlotMask = SlotsPerLevel - 1;
+	static constexpr int32 NumLevels = 3;
+
+	// Place an entry in the level whose span covers its deadline
+	void Schedule(const FEntry& Entry);
+
+	// Re-schedule every entry in a higher-level slot into finer levels
+	void Cascade(int32 Level, int32 SlotIndex);
+
+	// Seconds per wheel tick
+	float Resolution;
+
+	// Fractional time not yet converted into ticks
+	float Accumulator;
+
+	// Ticks elapsed since the wheel was created
+	uint64 CurrentTick;
+
+	// Wheel slots; an entry whose deadline no longer matches Deadlines is stale and dropped when reached
+	TArray<FEntry> Wheel[NumLevels][SlotsPerLevel];
+
+	// Live deadline per key
+	TMap<uint64, uint64> Deadlines;
+};
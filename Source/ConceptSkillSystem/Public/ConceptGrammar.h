@@ -0,0 +1,230 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "Concept.h"
+#include "ConceptGrammar.generated.h"
+
+// The part a concept plays in the 'sentence' formed by adjacent slots
+UENUM(BlueprintType)
+enum class EConceptGrammarRole : uint8
+{
+	Noun UMETA(DisplayName = "Noun"),
+	Verb UMETA(DisplayName = "Verb"),
+	Adjective UMETA(DisplayName = "Adjective"),
+	Adverb UMETA(DisplayName = "Adverb")
+};
+
+// A sequence of roles that links adjacent concepts, or that they may not form
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptGrammarRule
+{
+	GENERATED_BODY()
+
+	// Name reported for links formed by this rule
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	FName Name;
+
+	// Roles of two or more adjacent concepts, in chain order (left to right, top to bottom)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	TArray<EConceptGrammarRole> Pattern;
+
+	// Whether the pattern breaks the grammar instead of forming a link
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	bool bForbidden = false;
+
+	// Synergy a link formed by this rule adds
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	float Synergy = 1.0f;
+};
+
+// Concepts with a tag take a role regardless of their tier
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptGrammarTagRole
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	FGameplayTag Tag;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	EConceptGrammarRole Role = EConceptGrammarRole::Noun;
+};
+
+// A rule matched between adjacent slots, from the first slot's grid cell to the last's
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptGrammarLink
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Grammar")
+	FName Rule;
+
+	// Whether the rule breaks the grammar
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Grammar")
+	bool bForbidden = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Grammar")
+	FIntPoint FirstCell = FIntPoint::ZeroValue;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Grammar")
+	FIntPoint LastCell = FIntPoint::ZeroValue;
+};
+
+// The grammar of one body part's slots
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptGrammarReport
+{
+	GENERATED_BODY()
+
+	// Forbidden patterns found; the slots are grammatical when this is zero
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Grammar")
+	int32 Violations = 0;
+
+	// Synergy of every link formed
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Grammar")
+	float Synergy = 0.0f;
+
+	// Every rule matched, forbidden ones included
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Grammar")
+	TArray<FConceptGrammarLink> Links;
+};
+
+// Grammar checked over one chain of roles
+struct FConceptGrammarChainResult
+{
+	// Positions where a forbidden pattern ends
+	int32 Violations = 0;
+
+	// Synergy of every link formed
+	float Synergy = 0.0f;
+};
+
+// A rule matched in a chain: roles [Start, Start + Length) of the chain
+struct FConceptGrammarMatch
+{
+	int32 Rule;
+	int32 Start;
+	int32 Length;
+};
+
+/**
+ * FConceptGrammarAutomaton - Every rule pattern compiled into one deterministic finite automaton over roles
+ * Built as an Aho-Corasick automaton with every transition filled in, so scanning a chain is one table lookup per
+ * concept no matter how many rules there are. Each state knows whether a forbidden pattern ends there and the
+ * synergy of the links ending there; the rules themselves are only walked when a caller asks for the matches.
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptGrammarAutomaton
+{
+	static constexpr int32 NumRoles = 4;
+
+	// Build the automaton; patterns shorter than two roles link nothing and are skipped
+	void Compile(TConstArrayView<FConceptGrammarRule> Rules);
+
+	// The state after reading a role
+	int32 Step(int32 State, EConceptGrammarRole Role) const { return Transitions[State * NumRoles + static_cast<int32>(Role)]; }
+
+	// Scan a chain; OutMatches, if given, receives every rule matched
+	FConceptGrammarChainResult Scan(TConstArrayView<EConceptGrammarRole> Chain, TArray<FConceptGrammarMatch>* OutMatches = nullptr) const;
+
+	// Whether a forbidden pattern ends in a state
+	bool IsForbidden(int32 State) const { return Forbidden[State]; }
+
+	// Synergy of the allowed patterns ending in a state
+	float GetSynergy(int32 State) const { return Synergy[State]; }
+
+	// Call Visit(Rule) for every rule whose pattern ends in a state
+	template <typename FunctorType>
+	void ForEachMatch(int32 State, FunctorType&& Visit) const
+	{
+		for (int32 Current = OwnOutputs(State) ? State : OutputLinks[State]; Current != INDEX_NONE; Current = OutputLinks[Current])
+		{
+			for (uint32 Output = OutputStarts[Current]; Output < OutputStarts[Current + 1]; ++Output)
+			{
+				Visit(Outputs[Output]);
+			}
+		}
+	}
+
+	// Pattern length of a rule
+	int32 GetRuleLength(int32 Rule) const { return RuleLengths[Rule]; }
+
+	int32 NumStates() const { return Forbidden.Num(); }
+
+	bool IsEmpty() const { return Forbidden.Num() == 0; }
+
+private:
+	bool OwnOutputs(int32 State) const { return OutputStarts[State + 1] > OutputStarts[State]; }
+
+	// NumRoles transitions per state; state 0 is the start
+	TArray<int32> Transitions;
+
+	// Nearest proper suffix state with rules of its own (INDEX_NONE if none)
+	TArray<int32> OutputLinks;
+
+	// Rules ending exactly in each state, as compressed sparse rows
+	TArray<uint32> OutputStarts;
+	TArray<int32> Outputs;
+
+	// Per state, including everything its suffixes match
+	TArray<bool> Forbidden;
+	TArray<float> Synergy;
+
+	TArray<int32> RuleLengths;
+};
+
+/**
+ * UConceptGrammar - The rules by which adjacent concepts link, like the grammar of a language (design doc 6.4)
+ * Every concept plays a role: Physical concepts are verbs, which may not sit next to another verb, and the other tiers
+ * act as adjectives and nouns. Rules are role patterns that form links or break the grammar, compiled into a
+ * FConceptGrammarAutomaton when the asset is loaded or edited.
+ * Implements the "Synergistic and Emergent Capabilities" design pillar
+ */
+UCLASS(BlueprintType)
+class CONCEPTSKILLSYSTEM_API UConceptGrammar : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UConceptGrammar();
+
+	// Role of the concepts of each tier
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	TMap<EConceptTier, EConceptGrammarRole> TierRoles;
+
+	// Tags that override the tier's role; the first tag a concept has wins
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	TArray<FConceptGrammarTagRole> TagRoles;
+
+	// The link and forbidden patterns
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Grammar")
+	TArray<FConceptGrammarRule> Rules;
+
+	// The role a concept plays
+	UFUNCTION(BlueprintCallable, Category = "Concept Grammar")
+	EConceptGrammarRole GetRole(const UConcept* Concept) const;
+
+	// Rebuild the automaton; needed after changing rules at runtime
+	void Compile();
+
+	// The compiled rules, compiling them first if they never were
+	const FConceptGrammarAutomaton& GetAutomaton();
+
+	// Bumped by every compile, so validators built against an older automaton can tell
+	uint32 GetCompileVersion() const { return CompileVersion; }
+
+	// Begin UObject
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	// End UObject
+
+private:
+	FConceptGrammarAutomaton Automaton;
+
+	uint32 CompileVersion;
+};
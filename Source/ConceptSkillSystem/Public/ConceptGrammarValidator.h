@@ -0,0 +1,75 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ConceptGrammar.h"
+
+/**
+ * FConceptGrammarValidator - Grammar of a slot grid, kept up to date one cell at a time
+ * Every maximal run of two or more occupied cells along a row or column is a chain, scanned by the grammar's automaton
+ * in linear time. Results are kept per chain, so changing a cell only rescans the row and column chains through it.
+ * Implements the "Synergistic and Emergent Capabilities" design pillar
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptGrammarValidator
+{
+	// Start over with an empty grid checked against an automaton, which must outlive the validator or the next Reset
+	void Reset(const FConceptGrammarAutomaton* InAutomaton, int32 InWidth, int32 InHeight);
+
+	// Set the role in a cell, or empty it, and rescan the chains through it
+	void SetCell(int32 X, int32 Y, TOptional<EConceptGrammarRole> Role);
+
+	// The role in a cell, if it holds a concept
+	TOptional<EConceptGrammarRole> GetCell(int32 X, int32 Y) const;
+
+	// Forbidden patterns across every chain
+	int32 GetViolations() const { return Violations; }
+
+	// Synergy of every link across every chain
+	float GetSynergy() const { return Synergy; }
+
+	// Number of chains
+	int32 NumChains() const { return RowChains.Num() + ColumnChains.Num(); }
+
+	// Rescan every chain; SetCell keeps them current, so this is only for checking and benchmarking
+	void ValidateAll();
+
+	// Parse every chain: Visit(Match, FirstCell, Step) for each rule matched, where the matched cells are
+	// FirstCell + Step * [0, Match.Length)
+	void ForEachMatch(TFunctionRef<void(const FConceptGrammarMatch&, FIntPoint, FIntPoint)> Visit) const;
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+
+	bool IsValid() const { return Automaton != nullptr; }
+
+private:
+	static constexpr uint8 EmptyCell = 0xFF;
+
+	bool IsOccupied(int32 X, int32 Y) const { return X >= 0 && Y >= 0 && X < Width && Y < Height && Cells[Y * Width + X] != EmptyCell; }
+
+	// Start cell of the run through a cell along a direction (the cell must be occupied)
+	FIntPoint FindRunStart(FIntPoint Cell, FIntPoint Step) const;
+
+	// Drop, or rescan and store, the chains through a cell and its two neighbours along a direction
+	void RemoveChainsAround(FIntPoint Cell, FIntPoint Step, TMap<int32, FConceptGrammarChainResult>& Chains);
+	void ScanChainsAround(FIntPoint Cell, FIntPoint Step, TMap<int32, FConceptGrammarChainResult>& Chains);
+
+	// Read the roles of the run starting at a cell
+	void ReadRun(FIntPoint Start, FIntPoint Step, TArray<EConceptGrammarRole, TInlineAllocator<32>>& OutRun) const;
+
+	const FConceptGrammarAutomaton* Automaton = nullptr;
+	int32 Width = 0;
+	int32 Height = 0;
+
+	// Role per cell, row-major (EmptyCell if none)
+	TArray<uint8> Cells;
+
+	// Chains by the cell index they start at
+	TMap<int32, FConceptGrammarChainResult> RowChains;
+	TMap<int32, FConceptGrammarChainResult> ColumnChains;
+
+	// Totals over every chain
+	int32 Violations = 0;
+	float Synergy = 0.0f;
+};
@@ -0,0 +1,39 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Concept.h"
+
+struct FConceptCatalog;
+
+/**
+ * FConceptGraph - Queries over the RelatedConcepts graph of a catalog
+ * The graph is stored in the catalog as compressed sparse rows over dense concept indices, so queries never resolve
+ * soft pointers. Reachability is precomputed per strongly connected component when the catalog is built.
+ * Implements the "Understanding Through Observation and Interaction" design pillar
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptGraph
+{
+	// Concepts reachable from Start in breadth-first order, up to MaxHops links away (any distance if negative);
+	// Start itself is only included if it lies on a cycle. OutHops, if given, receives each concept's distance.
+	static void BreadthFirst(const FConceptCatalog& Catalog, int32 Start, int32 MaxHops, TArray<int32>& OutConcepts, TArray<int32>* OutHops = nullptr);
+
+	// Bitset (MaskWords words) of the concepts exactly K links away from Start
+	static void GetKHopMask(const FConceptCatalog& Catalog, int32 Start, int32 K, TArray<uint64>& OutMask);
+
+	// Whether To can be reached from From through one or more links
+	static bool CanReach(const FConceptCatalog& Catalog, int32 From, int32 To);
+
+	// Whether a concept leads, through one or more links, to any concept of a tier
+	static bool CanReachTier(const FConceptCatalog& Catalog, int32 Concept, EConceptTier Tier);
+
+	/**
+	 * Tarjan's strongly connected components over a compressed sparse row graph, then per-tier reachability
+	 * OutComponents: component of each node; components are numbered in completion order, so links only go to equal
+	 * or lower numbers. OutTierReach: NumTiers bitsets of MaskWords words; bit C of tier T is set if node C reaches a
+	 * node of tier T. Linear in nodes plus links.
+	 */
+	static void BuildReachability(TConstArrayView<uint32> Starts, TConstArrayView<uint32> Links, TConstArrayView<uint8> Tiers, int32 NumTiers, int32 MaskWords,
+		TArray<int32>& OutComponents, TArray<bool>& OutCyclic, TArray<uint64>& OutTierReach);
+};
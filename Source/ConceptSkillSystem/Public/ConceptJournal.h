@@ -0,0 +1,141 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Concept.h"
+#include "ConceptSlot.h"
+
+class UConceptRegistry;
+class FConceptSaveWriter;
+class FConceptSaveReader;
+class IFileHandle;
+
+// Kinds of concept-state mutations recorded in the journal
+enum class EConceptJournalOp : uint8
+{
+	Acquire,
+	MasteryDelta,
+	SlotReconfigure,
+	Unlock,
+	Mediate,
+	Forge,
+	Observe,
+	Progression,
+	CoreNodeAmplification
+};
+
+/**
+ * FConceptJournalRecord - One concept-state mutation
+ * Only the fields relevant to the op are written
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptJournalRecord
+{
+	// Monotonic per-journal sequence number
+	uint32 Sequence = 0;
+
+	// UTC time the mutation happened, in FDateTime ticks
+	int64 Timestamp = 0;
+
+	EConceptJournalOp Op = EConceptJournalOp::Acquire;
+
+	// Index of the affected slot in the owner's slot container
+	int32 SlotIndex = INDEX_NONE;
+
+	// Concepts involved (one for most ops, several for Mediate)
+	TArray<TSoftObjectPtr<UConcept>> Concepts;
+
+	// Body part for Acquire/SlotReconfigure/CoreNodeAmplification
+	EBodyPartType BodyPart = EBodyPartType::None;
+
+	// Max tier for SlotReconfigure/Unlock
+	EConceptTier Tier = EConceptTier::Physical;
+
+	// Applied mastery delta for MasteryDelta, always within [-100, 100]
+	int32 Amount = 0;
+
+	// Progression change for Unlock (cost) and Progression (gain); the resulting factor for CoreNodeAmplification
+	float Value = 0.0f;
+
+	// Active flag for Mediate
+	bool bFlag = false;
+
+	// Forge target name, kept for auditing
+	FString Target;
+
+	void Write(FConceptSaveWriter& Writer) const;
+	void Read(FConceptSaveReader& Reader);
+
+	// Human-readable line for audit logs
+	FString ToString() const;
+};
+
+/**
+ * IConceptJournal - Append-only store of concept-state mutations with periodic snapshot compaction
+ */
+class CONCEPTSKILLSYSTEM_API IConceptJournal
+{
+public:
+	virtual ~IConceptJournal() = default;
+
+	// Append a record; records must arrive in sequence order
+	virtual void Append(const FConceptJournalRecord& Record) = 0;
+
+	// Push buffered records to durable storage
+	virtual void Flush() = 0;
+
+	// Read the latest snapshot and every record appended after it
+	virtual bool Load(TArray<uint8>& OutSnapshot, uint32& OutSnapshotSequence, TArray<FConceptJournalRecord>& OutRecords) = 0;
+
+	// Replace the snapshot with one that covers every record up to and including LastSequence, then drop those records
+	virtual bool Compact(const TArray<uint8>& Snapshot, uint32 LastSequence) = 0;
+
+	// Whether the loaded records must be compacted before more can be appended, as when they use an older format or catalog
+	virtual bool NeedsCompaction() const { return false; }
+};
+
+/**
+ * FConceptFileJournal - IConceptJournal backed by local files
+ * <Key>.journal holds framed records, <Key>.snapshot the last compacted state.
+ * Compacted journals can be kept as <Key>.<Sequence>.audit for auditing.
+ */
+class CONCEPTSKILLSYSTEM_API FConceptFileJournal : public IConceptJournal
+{
+public:
+	FConceptFileJournal(const FString& InDirectory, const FString& InKey, const UConceptRegistry* InRegistry, bool bInKeepAuditTrail = true);
+	virtual ~FConceptFileJournal();
+
+	// IConceptJournal
+	virtual void Append(const FConceptJournalRecord& Record) override;
+	virtual void Flush() override;
+	virtual bool Load(TArray<uint8>& OutSnapshot, uint32& OutSnapshotSequence, TArray<FConceptJournalRecord>& OutRecords) override;
+	virtual bool Compact(const TArray<uint8>& Snapshot, uint32 LastSequence) override;
+	virtual bool NeedsCompaction() const override;
+
+	const FString& GetJournalPath() const { return JournalPath; }
+
+private:
+	// Open the journal for appending, writing the file header if it is new
+	bool OpenForAppend();
+
+	// Where Compact writes the new snapshot before swapping it in
+	FString GetTempSnapshotPath() const { return SnapshotPath + TEXT(".tmp"); }
+
+	FString Directory;
+	FString JournalPath;
+	FString SnapshotPath;
+	FString Key;
+	const UConceptRegistry* Registry;
+	bool bKeepAuditTrail;
+
+	// Save format version of the journal file's header, as last loaded
+	uint16 FileVersion;
+
+	// Catalog hash of the journal file's header; records can only be appended while it matches the current catalog
+	uint32 FileCatalogHash;
+
+	// Catalog indices the journal file's remap tables already define, so appended records don't repeat their paths
+	TSet<int32> DefinedConcepts;
+
+	TUniquePtr<IFileHandle> FileHandle;
+};
@@ -0,0 +1,118 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Concept.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "ConceptKnowledge.generated.h"
+
+/**
+ * FConceptKnowledgeEntry - What a character knows about a single concept
+ * Replicated only to the owning client
+ */
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptKnowledgeEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+public:
+	FConceptKnowledgeEntry();
+
+	// The concept this entry describes
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Knowledge")
+	TSoftObjectPtr<UConcept> Concept;
+
+	// Whether the concept has been observed
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Knowledge")
+	bool bObserved;
+
+	// Whether the concept has been acquired
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Knowledge")
+	bool bAcquired;
+
+	// FFastArraySerializer callbacks
+	void PreReplicatedRemove(const struct FConceptKnowledgeContainer& InArraySerializer);
+	void PostReplicatedAdd(const struct FConceptKnowledgeContainer& InArraySerializer);
+	void PostReplicatedChange(const struct FConceptKnowledgeContainer& InArraySerializer);
+};
+
+/**
+ * FConceptKnowledgeContainer - Delta-replicated mirror of the observed and acquired concept sets
+ */
+USTRUCT()
+struct CONCEPTSKILLSYSTEM_API FConceptKnowledgeContainer : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+public:
+	// One entry per concept the character knows about
+	UPROPERTY()
+	TArray<FConceptKnowledgeEntry> Items;
+
+	// The component that owns this container (not replicated)
+	class UConceptComponent* Owner = nullptr;
+
+	// Record that a concept was observed
+	void MarkObserved(UConcept* Concept);
+
+	// Record that a concept was acquired
+	void MarkAcquired(UConcept* Concept);
+
+	// Undo MarkObserved/MarkAcquired (used when rolling back a snapshot)
+	void ClearObserved(UConcept* Concept);
+	void ClearAcquired(UConcept* Concept);
+
+	// Remove every entry
+	void Reset();
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FConceptKnowledgeEntry, FConceptKnowledgeContainer>(Items, DeltaParms, *this);
+	}
+
+private:
+	// Find the entry for a concept, adding one if needed
+	FConceptKnowledgeEntry& FindOrAdd(UConcept* Concept);
+
+	// Mark an entry for replication, unless the owner is previewing and the change is about to be undone
+	void MarkEntryDirty(FConceptKnowledgeEntry& Entry);
+};
+
+template<>
+struct TStructOpsTypeTraits<FConceptKnowledgeContainer> : public TStructOpsTypeTraitsBase2<FConceptKnowledgeContainer>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * FConceptPublicSummary - Coarse view of a character's concepts sent to everyone but the owner
+ */
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptPublicSummary
+{
+	GENERATED_BODY()
+
+public:
+	// Tags of every concept currently held in a slot
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Summary")
+	FGameplayTagContainer VisibleTags;
+
+	// Number of slotted concepts per tier, indexed by EConceptTier
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Summary")
+	TArray<uint8> TierCounts;
+
+	// A few synergies that are visible to other players
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Summary")
+	TArray<FString> PublicSynergies;
+
+	// Get the number of slotted concepts of a tier
+	int32 GetTierCount(EConceptTier Tier) const;
+
+	bool operator==(const FConceptPublicSummary& Other) const;
+	bool operator!=(const FConceptPublicSummary& Other) const { return !(*this == Other); }
+};
@@ -8,6 +8,9 @@
 #include "Concept.h"
 #include "ConceptObservableActor.generated.h"
 
+class UConceptObservationSubsystem;
+struct FStreamableHandle;
+
 /**
  * AConceptObservableActor - Base class for actors that can be observed to learn concepts
  * Implements the "Understanding Through Observation and Interaction" design pillar
@@ -21,7 +24,7 @@ public:
 	AConceptObservableActor();
 
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// The concepts that can be observed from this actor
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
@@ -35,14 +38,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System")
 	bool bCanBeObserved;
 
-	// The cooldown time between observations (in seconds)
+	// The cooldown time between observations by the same observer (in seconds)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept System", meta = (ClampMin = "0.0"))
 	float ObservationCooldown;
 
-	// The time when this actor was last observed
-	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
-	float LastObservedTime;
-
 	// IConceptObservable interface
 	virtual TArray<UConcept*> GetObservableConcepts_Implementation() const override;
 	virtual float GetObservationQuality_Implementation() const override;
@@ -53,7 +52,39 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Concept System")
 	void BP_OnObserved(AActor* Observer);
 
-	// Check if the observation cooldown has elapsed
+	// Check if this observer's observation cooldown on this actor has elapsed
+	UFUNCTION(BlueprintCallable, Category = "Concept System")
+	bool HasObservationCooldownElapsed(const AActor* Observer) const;
+
+	// Resolve ObservableConcepts again, loading any that are not in memory; call after changing ObservableConcepts
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
-	bool HasObservationCooldownElapsed() const;
+	void RefreshObservableConcepts();
+
+	// The observable concepts, resolved and pinned once (empty until loading completes); ignores Blueprint overrides of
+	// GetObservableConcepts, so check IsNativeImplementation first
+	TConstArrayView<UConcept*> GetResolvedConcepts() const { return ResolvedConcepts; }
+
+	// AcquisitionDifficulty of each resolved concept, indexed like GetResolvedConcepts
+	TConstArrayView<float> GetAcquisitionDifficulties() const { return AcquisitionDifficulties; }
+
+	// Whether an IConceptObservable function runs the C++ implementation, so its cached data can be read directly
+	bool IsNativeImplementation(FName FunctionName) const;
+
+private:
+	// Cache the loaded concepts and their difficulties
+	void ResolveConcepts();
+
+	// Loaded observable concepts, held so they cannot be collected
+	UPROPERTY(Transient)
+	TArray<UConcept*> ResolvedConcepts;
+
+	// Acquisition difficulty per resolved concept
+	TArray<float> AcquisitionDifficulties;
+
+	// Pending async load of unloaded concepts
+	TSharedPtr<FStreamableHandle> ConceptLoadHandle;
+
+	// Subsystem holding the per-observer cooldowns, cached at BeginPlay
+	UPROPERTY(Transient)
+	UConceptObservationSubsystem* ObservationSubsystem;
 };
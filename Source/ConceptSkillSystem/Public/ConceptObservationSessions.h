@@ -0,0 +1,82 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UConcept;
+class UConceptComponent;
+
+// A session that reached full understanding during an update
+struct FConceptObservationCompletion
+{
+	UConceptComponent* Observer;
+	UConcept* Concept;
+	float Quality;
+
+	// The observable the concept was last studied on (may be null if it was destroyed)
+	AActor* Observable;
+};
+
+/**
+ * FConceptObservationSessions - Understanding accumulated per (observer, concept) while the concept is in view
+ * Stored as parallel arrays so the batched update only streams the fields it reads
+ * Implements the "Understanding Through Observation and Interaction" design pillar
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptObservationSessions
+{
+	FConceptObservationSessions();
+
+	// Find or start the session for an observer studying a concept on an observable, and credit it with time spent in view
+	void Touch(UConceptComponent* Observer, UConcept* Concept, AActor* Observable, float Rate, float Quality, float InViewTime, double Now);
+
+	// Apply pending study time, starting where the last update stopped, until the time budget runs out
+	void Advance(double Now, double BudgetSeconds, float ForgetTime, TArray<FConceptObservationCompletion>& OutCompleted);
+
+	// Understanding (0-1) an observer has of a concept, or 0 if no session is open
+	float GetProgress(const UConceptComponent* Observer, const UConcept* Concept) const;
+
+	// Number of open sessions
+	int32 Num() const { return Progress.Num(); }
+
+	// Drop every session
+	void Reset();
+
+private:
+	// Remove a session by swapping the last one into its place
+	void RemoveAtSwap(int32 Index);
+
+	static uint64 MakeKey(const UConceptComponent* Observer, const UConcept* Concept);
+
+	// (observer, concept) key of each session
+	TArray<uint64> Keys;
+
+	// Who is studying what
+	TArray<TWeakObjectPtr<UConceptComponent>> Observers;
+	TArray<TWeakObjectPtr<UConcept>> Concepts;
+
+	// Observable the concept was last in view on
+	TArray<TWeakObjectPtr<AActor>> Observables;
+
+	// Understanding so far, 0-1
+	TArray<float> Progress;
+
+	// Understanding gained per second in view
+	TArray<float> Rates;
+
+	// Time in view not yet applied to Progress
+	TArray<float> PendingTime;
+
+	// Observation quality passed on when the session completes
+	TArray<float> Qualities;
+
+	// Last time the concept was in view for this observer
+	TArray<double> LastSeenTimes;
+
+	// Session index per (observer, concept) key
+	TMap<uint64, int32> IndexByKey;
+
+	// Where the next budgeted update resumes
+	int32 Cursor;
+};
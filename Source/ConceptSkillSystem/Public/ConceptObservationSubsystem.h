@@ -0,0 +1,204 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ConceptCooldownWheel.h"
+#include "ConceptObservationSessions.h"
+#include "ConceptObservationSubsystem.generated.h"
+
+class UConcept;
+class UConceptComponent;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnObservationQueryComplete, class UConceptObservationSubsystem*);
+
+/**
+ * UConceptObservationSubsystem - Finds, for every observer at once, the observables within its ObservationRange
+ * Observables live in a uniform spatial hash; the range query runs in parallel over observers once per frame,
+ * driven by UConceptSystemSubsystem
+ * Also owns per-(observer, observable) observation cooldowns so one observer never locks an object for everyone,
+ * and the observation sessions that build understanding of concepts kept in view
+ * Implements the "Understanding Through Observation and Interaction" design pillar
+ */
+UCLASS(Config = Game)
+class CONCEPTSKILLSYSTEM_API UConceptObservationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UConceptObservationSubsystem();
+
+	// Begin USubsystem
+	virtual void Deinitialize() override;
+	// End USubsystem
+
+	// Edge length of a spatial hash cell; should be on the order of a typical ObservationRange
+	UPROPERTY(Config, EditAnywhere, Category = "Concept Observation", meta = (ClampMin = "100.0"))
+	float CellSize;
+
+	// Range used for observers without a concept attribute set
+	UPROPERTY(Config, EditAnywhere, Category = "Concept Observation", meta = (ClampMin = "0.0"))
+	float DefaultObservationRange;
+
+	// Observables whose CanBeObserved is overridden in Blueprint (or not an AConceptObservableActor) polled per update (0 = all)
+	UPROPERTY(Config, EditAnywhere, Category = "Concept Observation", meta = (ClampMin = "0"))
+	int32 MaxCanBeObservedPolls;
+
+	// Whether observers study concepts in view over time, in addition to one-shot observation (opt-in)
+	UPROPERTY(Config, EditAnywhere, Category = "Concept Observation")
+	bool bContinuousObservation;
+
+	// Seconds of study per point of AcquisitionDifficulty at ObservationSpeed 1
+	UPROPERTY(Config, EditAnywhere, Category = "Concept Observation", meta = (ClampMin = "0.01", EditCondition = "bContinuousObservation"))
+	float StudySecondsPerDifficulty;
+
+	// Seconds a concept can be out of view before its session is forgotten
+	UPROPERTY(Config, EditAnywhere, Category = "Concept Observation", meta = (ClampMin = "0.0", EditCondition = "bContinuousObservation"))
+	float SessionForgetTime;
+
+	// Cooldown between an observer and the observable a session completed on, for observables that don't set their own
+	UPROPERTY(Config, EditAnywhere, Category = "Concept Observation", meta = (ClampMin = "0.0", EditCondition = "bContinuousObservation"))
+	float SessionCompleteCooldown;
+
+	// Add an actor implementing IConceptObservable to the spatial hash
+	UFUNCTION(BlueprintCallable, Category = "Concept Observation")
+	void RegisterObservable(AActor* Observable);
+
+	// Remove an observable from the spatial hash
+	UFUNCTION(BlueprintCallable, Category = "Concept Observation")
+	void UnregisterObservable(AActor* Observable);
+
+	// Start answering range queries for an observer
+	void RegisterObserver(UConceptComponent* Observer);
+
+	// Stop answering range queries for an observer
+	void UnregisterObserver(UConceptComponent* Observer);
+
+	// The observables that were in range and observable for this observer on the last update
+	UFUNCTION(BlueprintCallable, Category = "Concept Observation")
+	TArray<AActor*> GetObservablesInRange(UConceptComponent* Observer) const;
+
+	// Advance cooldowns, run the range query and study sessions; sessions not reached within the budget keep their study time
+	void Update(float DeltaTime, double BudgetSeconds);
+
+	// Run the batched query now instead of waiting for the next update
+	void UpdateObservation();
+
+	// Credit observers with study on everything in range, then advance sessions, both within the budget;
+	// observers not reached this update are credited for the missed time on a later one
+	void UpdateSessions(float DeltaTime, double BudgetSeconds);
+
+	// Understanding (0-1) an observer has built of a concept through continuous observation
+	UFUNCTION(BlueprintCallable, Category = "Concept Observation")
+	float GetObservationProgress(UConceptComponent* Observer, UConcept* Concept) const;
+
+	// Number of open observation sessions
+	int32 GetNumSessions() const { return Sessions.Num(); }
+
+	// Broadcast after each batched query
+	FOnObservationQueryComplete OnObservationQueryComplete;
+
+	// Number of registered observers
+	int32 GetNumObservers() const { return Observers.Num(); }
+
+	// Observer at a dense index (valid for the current update)
+	UConceptComponent* GetObserver(int32 ObserverIndex) const { return Observers[ObserverIndex].Get(); }
+
+	// Indices into the observable table found in range for an observer
+	const TArray<int32>& GetResultsForObserver(int32 ObserverIndex) const { return Results[ObserverIndex]; }
+
+	// Observable actor for an index returned by GetResultsForObserver
+	AActor* GetObservable(int32 ObservableIndex) const { return Observables[ObservableIndex].Actor.Get(); }
+
+	// Start the observation cooldown between an observer and an observable
+	void StartObservationCooldown(const AActor* Observer, const AActor* Observable, float Duration);
+
+	// Whether this observer must still wait before observing this observable again
+	bool IsObservationOnCooldown(const AActor* Observer, const AActor* Observable) const;
+
+	// Seconds left before this observer may observe this observable again
+	UFUNCTION(BlueprintCallable, Category = "Concept Observation")
+	float GetObservationCooldownRemaining(const AActor* Observer, const AActor* Observable) const;
+
+	// Get the subsystem for a world
+	static UConceptObservationSubsystem* Get(const UObject* WorldContextObject);
+
+private:
+	struct FObservableEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector Location = FVector::ZeroVector;
+		FIntVector Cell = FIntVector::ZeroValue;
+
+		// Observable actor's unique ID, used to look up cooldowns during the parallel query
+		uint32 ObservableId = 0;
+
+		// CanBeObserved, cached on the game thread before the parallel query
+		bool bCanBeObserved = false;
+
+		// Whether CanBeObserved is the native AConceptObservableActor one, which reads a property instead of calling out
+		bool bNativeCanBeObserved = false;
+
+		// Whether GetObservableConcepts is the native AConceptObservableActor one, whose resolved concepts can be read directly
+		bool bNativeConcepts = false;
+	};
+
+	struct FObserverQuery
+	{
+		FVector Location = FVector::ZeroVector;
+		float Range = 0.0f;
+
+		// ObservationSpeed of the observer
+		float Speed = 1.0f;
+
+		// Observer actor's unique ID, used to look up cooldowns during the parallel query
+		uint32 ObserverId = 0;
+
+		// Seconds in view not yet credited to sessions because the budget ran out first
+		float UncreditedStudyTime = 0.0f;
+	};
+
+	// Cell that contains a location
+	FIntVector GetCell(const FVector& Location) const;
+
+	// Move observables that changed cells and cache CanBeObserved (game thread only)
+	void RefreshObservables();
+
+	// Collect observer locations and ranges (game thread only)
+	void GatherObserverQueries();
+
+	// Remove an observable index from its cell bucket
+	void RemoveFromCell(int32 ObservableIndex);
+
+	// Find the observables in range of one query; safe to run in parallel
+	void QueryObservables(const FObserverQuery& Query, TArray<int32>& OutInRange) const;
+
+	// Observable table; freed entries have a null actor and are reused
+	TArray<FObservableEntry> Observables;
+	TArray<int32> FreeObservableIndices;
+	TMap<TWeakObjectPtr<AActor>, int32> ObservableIndexByActor;
+
+	// Spatial hash: observable indices per cell
+	TMap<FIntVector, TArray<int32>> Cells;
+
+	// Where the next round of CanBeObserved polls starts in the observable table
+	int32 NextCanBeObservedPoll;
+
+	// Observer the next budgeted study credit starts with
+	int32 NextCreditObserver;
+
+	// Observers and their per-update query inputs and results, all indexed alike
+	TArray<TWeakObjectPtr<UConceptComponent>> Observers;
+	TArray<FObserverQuery> Queries;
+	TArray<TArray<int32>> Results;
+
+	// Active observation cooldowns keyed by (observer ID, observable ID)
+	FConceptCooldownWheel ObservationCooldowns;
+
+	// Open observation sessions
+	FConceptObservationSessions Sessions;
+
+	// Sessions completed in the current update, kept to avoid reallocating every frame
+	TArray<FConceptObservationCompletion> CompletedSessions;
+};
@@ -6,10 +6,13 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Concept.h"
 #include "ConceptSkill.h"
+#include "ConceptCatalog.h"
+#include "Engine/StreamableManager.h"
 #include "ConceptRegistry.generated.h"
 
 /**
  * UConceptRegistry - Subsystem that manages all concepts and skills in the game
+ * A thin per-game-instance view onto the published FConceptCatalog, so the catalog is built once per process
  */
 UCLASS()
 class CONCEPTSKILLSYSTEM_API UConceptRegistry : public UGameInstanceSubsystem
@@ -22,30 +25,29 @@ public:
 	virtual void Deinitialize() override;
 	// End USubsystem
 
-	// All concepts available in the game
-	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
-	TArray<TSoftObjectPtr<UConcept>> AllConcepts;
+	// All concepts available in the game, sorted by path
+	UFUNCTION(BlueprintPure, Category = "Concept System")
+	const TArray<TSoftObjectPtr<UConcept>>& GetAllConcepts() const { return GetCatalog().Concepts; }
 
 	// All skills available in the game
-	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
-	TArray<TSoftObjectPtr<UConceptSkill>> AllSkills;
+	UFUNCTION(BlueprintPure, Category = "Concept System")
+	const TArray<TSoftObjectPtr<UConceptSkill>>& GetAllSkills() const { return GetCatalog().Skills; }
 
-	// Concepts organized by tier
-	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
-	TMap<EConceptTier, TArray<TSoftObjectPtr<UConcept>>> ConceptsByTier;
+	// The catalog currently published; don't hold on to it across frames
+	const FConceptCatalog& GetCatalog() const { return FConceptCatalog::GetPublished(); }
 
-	// Skills organized by manifestation type
-	UPROPERTY(BlueprintReadOnly, Category = "Concept System")
-	TMap<ESkillManifestationType, TArray<TSoftObjectPtr<UConceptSkill>>> SkillsByType;
-
-	// Load all concepts from the content directory
+	// Rescan every asset and publish a new catalog for all game instances
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	void LoadAllConcepts();
 
-	// Load all skills from the content directory
+	// Same as LoadAllConcepts: concepts and skills are indexed together
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	void LoadAllSkills();
 
+	// Re-index only the given assets off the game thread; the new catalog is published when it is ready
+	UFUNCTION(BlueprintCallable, Category = "Concept System")
+	void RefreshCatalogAssets(const TArray<FSoftObjectPath>& ChangedAssets, const TArray<FSoftObjectPath>& RemovedAssets);
+
 	// Get all concepts of a specific tier
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	TArray<TSoftObjectPtr<UConcept>> GetConceptsByTier(EConceptTier Tier) const;
@@ -62,18 +64,38 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	UConceptSkill* FindSkillByName(const FString& SkillName) const;
 
+	// Concepts a concept leads to through RelatedConcepts, nearest first, up to MaxHops links away (any distance if negative)
+	UFUNCTION(BlueprintCallable, Category = "Concept System")
+	TArray<UConcept*> GetDiscoverableConcepts(UConcept* Concept, int32 MaxHops = 1) const;
+
+	// Whether a concept leads, through RelatedConcepts, to any concept of a tier
+	UFUNCTION(BlueprintCallable, Category = "Concept System")
+	bool CanDiscoverTier(UConcept* Concept, EConceptTier Tier) const;
+
 	// Get all skills that require a specific concept
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	TArray<TSoftObjectPtr<UConceptSkill>> GetSkillsRequiringConcept(UConcept* Concept) const;
 
+	// Load the UI bundle (icons and other display-only data) of catalog assets; keep the handle while the UI needs it
+	// Does nothing on dedicated servers, whose cooks have no UI data
+	TSharedPtr<FStreamableHandle> RequestUIBundle(const TArray<FPrimaryAssetId>& AssetIds, FStreamableDelegate OnLoaded = FStreamableDelegate());
+
+	// Drop the UI bundle of catalog assets again, keeping only gameplay data loaded
+	void ReleaseUIBundle(const TArray<FPrimaryAssetId>& AssetIds);
+
+	// Get the dense index of a concept in the current catalog (INDEX_NONE if not in it); shifts when the catalog is refreshed
+	int32 GetConceptIndex(const TSoftObjectPtr<UConcept>& Concept) const;
+
+	// Get a concept by its dense index (nullptr if out of range)
+	UConcept* GetConceptByIndex(int32 Index) const;
+
+	// Log resident bytes per loaded concept and skill, as loaded on a client and with server-stripped data removed
+	void DumpMemoryReport(FOutputDevice& Ar) const;
+
+	// Hash of the ordered concept catalog; saved data is only valid against the same hash
+	uint32 GetCatalogHash() const { return GetCatalog().Hash; }
+
 	// Get the singleton instance
 	UFUNCTION(BlueprintCallable, Category = "Concept System", meta = (WorldContext = "WorldContextObject"))
 	static UConceptRegistry* GetConceptRegistry(const UObject* WorldContextObject);
-
-private:
-	// Organize concepts by tier
-	void OrganizeConceptsByTier();
-
-	// Organize skills by manifestation type
-	void OrganizeSkillsByType();
 };
@@ -0,0 +1,97 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UConcept;
+class UConceptComponent;
+
+// Instruction kinds of a compiled requirement program
+enum class EConceptRequirementOp : uint8
+{
+	// Always met (a skill with no requirements)
+	True,
+	// Concepts[Operand] acquired with at least Threshold mastery
+	Concept,
+	// The owner has Tags[Operand]
+	Tag,
+	// The one child is not met
+	Not,
+	// At least Threshold of the Operand children are met; AND and OR are the all-of and one-of cases
+	AtLeast
+};
+
+// One instruction; children follow their parent, and Size spans the instruction and all of its children
+struct FConceptRequirementInstruction
+{
+	EConceptRequirementOp Op;
+	uint16 Threshold;
+	uint16 Operand;
+	uint16 Size;
+};
+
+// What a requirement program is evaluated against
+struct FConceptRequirementContext
+{
+	FConceptRequirementContext(TFunctionRef<int32(const FSoftObjectPath&)> InGetMastery, const FGameplayTagContainer& InOwnerTags)
+		: GetMastery(InGetMastery)
+		, OwnerTags(InOwnerTags)
+	{
+	}
+
+	// Highest mastery of a concept, or INDEX_NONE if it is not acquired
+	TFunctionRef<int32(const FSoftObjectPath&)> GetMastery;
+
+	// Tags the owner has
+	const FGameplayTagContainer& OwnerTags;
+};
+
+/**
+ * FConceptRequirementProgram - A skill's requirement expression, compiled to a flat prefix-order program
+ * Expressions combine concepts from the skill's RequiredConcepts, by asset name, with AND, OR, NOT and N-of-M:
+ *     Fire >= 60 & (Water | Earth) & !tag(State.Cursed)
+ *     2 of (Fire, Water >= 30, Earth)
+ * A concept without a threshold needs the skill's RequiredMasteryLevel; ">= 0" only needs it acquired.
+ * One interpreter evaluates every program and skips the rest of a group as soon as its outcome is decided.
+ * Implements the "Synergistic and Emergent Capabilities" design pillar
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptRequirementProgram
+{
+	// Compile an expression; an empty one requires every concept at DefaultMastery. On failure the program is never met.
+	bool Compile(const FString& Expression, TConstArrayView<TSoftObjectPtr<UConcept>> RequiredConcepts, int32 DefaultMastery, FString& OutError);
+
+	// Whether Compile has run
+	bool IsCompiled() const { return bCompiled; }
+
+	// Whether the requirements are met; safe on any thread as long as the context is
+	bool Evaluate(const FConceptRequirementContext& Context) const;
+
+	// Evaluate against a concept component's acquired concepts and mastery (game thread)
+	bool Evaluate(const UConceptComponent* Component, const FGameplayTagContainer& OwnerTags) const;
+
+	// The instructions, in prefix order
+	TConstArrayView<FConceptRequirementInstruction> GetCode() const { return Code; }
+
+	// Concepts and tags the instructions refer to
+	TConstArrayView<FSoftObjectPath> GetConcepts() const { return Concepts; }
+	TConstArrayView<FGameplayTag> GetTags() const { return Tags; }
+
+	// Concepts the program refers to outside any NOT. Acquiring all of them is enough to meet an expression without
+	// NOT or tag terms, though an OR or N-of-M group needs fewer; they are exactly what is needed when IsConjunction.
+	// OutThresholds, if given, receives the highest mastery each of them is tested against.
+	void GetPositiveConcepts(TArray<FSoftObjectPath>& OutConcepts, TArray<int32>* OutThresholds = nullptr) const;
+
+	// Whether the program only ANDs concepts together (no OR, N-of-M, NOT or tag terms)
+	bool IsConjunction() const;
+
+private:
+	// Evaluate the instruction at PC and its children, leaving PC after them
+	bool EvaluateAt(const FConceptRequirementContext& Context, int32& PC) const;
+
+	TArray<FConceptRequirementInstruction> Code;
+	TArray<FSoftObjectPath> Concepts;
+	TArray<FGameplayTag> Tags;
+	bool bCompiled = false;
+};
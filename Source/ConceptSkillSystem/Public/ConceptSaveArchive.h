@@ -0,0 +1,196 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "ConceptSlot.h"
+
+class UConceptRegistry;
+
+/**
+ * Binary layout shared by every concept state blob:
+ *   uint32 Magic | uint16 Version | uint32 CatalogHash | remap table | payload
+ * Concepts are stored as packed (dense catalog index + 1), with 0 meaning "none". The remap table is a packed byte size
+ * followed by the (catalog index, asset path) of each concept the file refers to, each path written once per file.
+ * A reader whose catalog hash matches skips the table by its size and uses the indices as they are; only when the
+ * catalog changed are the paths resolved, so adding or removing concept assets never invalidates a blob, and
+ * concepts that no longer exist read as "none".
+ * Journal records use the same encoding without the header; their tables only define concepts that no earlier record
+ * of the same journal file did, so a record that reuses known concepts carries no paths at all.
+ * Version 1 blobs have no remap table and only load against the catalog they were written with; version 2 blobs
+ * stored a table of every path in place of catalog indices.
+ */
+namespace ConceptSaveFormat
+{
+	// Identifies a concept state blob ('CSK1')
+	constexpr uint32 Magic = 0x43534B31;
+
+	enum class EVersion : uint16
+	{
+		Initial = 1,
+
+		// Path table instead of catalog indices; slot IDs are kept and durability is no longer capped to a byte
+		PathTable = 2,
+
+		// Catalog indices again, with a per-file remap table that is only read when the catalog hash differs
+		CatalogRemap = 3,
+
+		// Add new versions above this line
+		VersionPlusOne,
+		Latest = VersionPlusOne - 1
+	};
+
+	// Per-slot flags; only fields that differ from the default slot are written
+	enum ESlotFlags : uint8
+	{
+		SlotFlag_Unlocked = 1 << 0,
+		SlotFlag_Concept = 1 << 1,
+		SlotFlag_Mastery = 1 << 2,
+		SlotFlag_MaxTier = 1 << 3,
+		SlotFlag_Coordinates = 1 << 4
+	};
+}
+
+// The catalog a file's concept indices refer to, as seen by the current catalog; shared by every record of a journal
+struct FConceptSaveRemap
+{
+	// Whether the file was written against the current catalog, so its indices are used as they are
+	bool bCatalogMatches = true;
+
+	// Also collect Defined when the catalog matches, as journals do to keep appending without redefining concepts
+	bool bTrackDefined = false;
+
+	// Concepts by the writer's catalog index (nullptr for ones no longer in the catalog); only filled on a mismatch
+	TMap<int32, UConcept*> Concepts;
+
+	// Catalog indices the file's remap tables have defined so far
+	TSet<int32> Defined;
+};
+
+/**
+ * FConceptSaveWriter - Writes concept state as compact, versioned binary
+ * Fields are written directly, without tagged-property reflection
+ */
+class CONCEPTSKILLSYSTEM_API FConceptSaveWriter
+{
+public:
+	FConceptSaveWriter(TArray<uint8>& InBuffer, const UConceptRegistry* InRegistry);
+	~FConceptSaveWriter();
+
+	// Start the blob with the magic, version and catalog hash (written by Finish, ahead of the remap table)
+	void WriteHeader();
+
+	// Write the header, if any, and the remap table to the buffer, followed by everything written so far.
+	// Concepts already in InOutDefined are left out of the table, and the ones written are added to it.
+	void Finish(TSet<int32>* InOutDefined = nullptr);
+
+	void WriteByte(uint8 Value);
+	void WritePacked(uint32 Value);
+	void WriteFloat(float Value);
+	void WriteInt64(int64 Value);
+	void WriteString(const FString& Value);
+	void WriteGuid(const FGuid& Value);
+
+	// Write a concept as its packed catalog index; concepts not in the catalog are written as none
+	void WriteConcept(const TSoftObjectPtr<UConcept>& Concept);
+
+	// Write a set of concepts as sorted, gap-encoded catalog indices
+	void WriteConceptSet(const TSet<TSoftObjectPtr<UConcept>>& Concepts);
+
+	// Write the fields of a slot that differ from DefaultSlot
+	void WriteSlot(const FConceptSlot& Slot, const FConceptSlot& DefaultSlot);
+
+private:
+	// Catalog index of a concept, noting it for the remap table (INDEX_NONE if it is not in the catalog)
+	int32 GetCatalogIndex(const TSoftObjectPtr<UConcept>& Concept);
+
+	// Where the finished blob goes
+	TArray<uint8>& Output;
+
+	// Everything written before Finish, which puts the remap table in front of it
+	TArray<uint8> Payload;
+	FMemoryWriter Ar;
+
+	const UConceptRegistry* Registry;
+
+	// Catalog indices referenced by the payload, in first-use order, and their paths
+	TArray<int32> UsedIndices;
+	TMap<int32, FSoftObjectPath> UsedPaths;
+
+	bool bWriteHeader;
+	bool bFinished;
+};
+
+/**
+ * FConceptSaveReader - Reads concept state written by FConceptSaveWriter
+ * Reads straight out of the caller's buffer without copying it
+ */
+class CONCEPTSKILLSYSTEM_API FConceptSaveReader
+{
+public:
+	FConceptSaveReader(TArrayView<const uint8> InData, const UConceptRegistry* InRegistry);
+
+	// Read concept indices through a remap shared with other readers of the same file, instead of this reader's own
+	void SetRemap(FConceptSaveRemap& InRemap) { Remap = &InRemap; }
+
+	// Validate the magic and version and read the remap or path table; false if the blob can't be read
+	bool ReadHeader();
+
+	// Start reading a headerless payload (a journal record) written at the given version
+	bool ReadPayloadHeader(uint16 InVersion);
+
+	// The catalog hash the blob was written against (valid after ReadHeader)
+	uint32 GetCatalogHash() const { return CatalogHash; }
+
+	uint8 ReadByte();
+	uint32 ReadPacked();
+	float ReadFloat();
+	int64 ReadInt64();
+	FString ReadString();
+	FGuid ReadGuid();
+
+	// Read a concept written by WriteConcept (nullptr for none or unknown)
+	UConcept* ReadConcept();
+
+	// Read a set of concepts written by WriteConceptSet
+	void ReadConceptSet(TSet<TSoftObjectPtr<UConcept>>& OutConcepts);
+
+	// Apply the fields written by WriteSlot on top of a slot initialized to its default
+	void ReadSlot(FConceptSlot& InOutSlot);
+
+	// The version of the blob being read (valid after ReadHeader)
+	uint16 GetVersion() const { return Version; }
+
+	// Whether the reader ran past the end of the data or hit a malformed value
+	bool IsError() const { return Ar.IsError(); }
+
+	// Whether every byte has been consumed
+	bool AtEnd() { return Ar.AtEnd(); }
+
+	// Current read offset in bytes
+	int64 Tell() { return Ar.Tell(); }
+
+private:
+	// Read the path table of a version 2 payload and resolve every path against the current catalog
+	bool ReadPathTable();
+
+	// Read a remap table: skipped by its size when the catalog matches, otherwise resolved by path
+	bool ReadRemapTable();
+
+	// A concept by its stored index: a path table index in version 2 blobs, otherwise a catalog index
+	UConcept* ResolveConcept(int32 Index);
+
+	FMemoryReaderView Ar;
+	const UConceptRegistry* Registry;
+	uint16 Version;
+	uint32 CatalogHash;
+
+	// How catalog indices resolve; OwnRemap unless SetRemap shares one
+	FConceptSaveRemap OwnRemap;
+	FConceptSaveRemap* Remap;
+
+	// A version 2 path table's concepts (nullptr for ones no longer in the catalog)
+	TArray<UConcept*> TableConcepts;
+};
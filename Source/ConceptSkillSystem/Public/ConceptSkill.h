@@ -6,6 +6,7 @@
 #include "GameplayAbilitySpec.h"
 #include "GameplayTagContainer.h"
 #include "Concept.h"
+#include "ConceptRequirement.h"
 #include "ConceptSkill.generated.h"
 
 UENUM(BlueprintType)
@@ -22,40 +23,45 @@ enum class ESkillManifestationType : uint8
  * Implements the "Diverse Manifestation of Ability" design pillar
  */
 UCLASS(BlueprintType)
-class CONCEPTSKILLSYSTEM_API UConceptSkill : public UDataAsset
+class CONCEPTSKILLSYSTEM_API UConceptSkill : public UPrimaryDataAsset
 {
 	GENERATED_BODY()
 
 public:
 	UConceptSkill();
 
-	// The display name of the skill
+	// The display name of the skill; stripped from server cooks
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
 	FText DisplayName;
 
-	// Description of the skill
+	// Description of the skill; stripped from server cooks
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill", meta = (MultiLine = true))
 	FText Description;
 
-	// Icon representing the skill
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
-	UTexture2D* Icon;
+	// Icon representing the skill; only loaded with the UI bundle, stripped from server cooks
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill", meta = (AssetBundles = "UI"))
+	TSoftObjectPtr<UTexture2D> Icon;
 
 	// The type of manifestation this skill represents
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill", AssetRegistrySearchable)
 	ESkillManifestationType ManifestationType;
 
-	// The concepts required to form this skill
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
+	// The concepts required to form this skill; loaded with the skill so unlock evaluation never waits on them
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill", meta = (AssetBundles = "Gameplay"))
 	TArray<TSoftObjectPtr<UConcept>> RequiredConcepts;
 
 	// The minimum mastery level required for each concept (0-100)
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill", meta = (ClampMin = "0", ClampMax = "100"))
 	int32 RequiredMasteryLevel;
 
-	// The gameplay ability class this skill grants (if it's an active skill)
+	// How RequiredConcepts combine, e.g. "Fire >= 60 & (Water | Earth)" or "2 of (Fire, Water, Earth)" (see FConceptRequirementProgram);
+	// empty requires every concept at RequiredMasteryLevel
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
+	FString RequirementExpression;
+
+	// The gameplay ability class this skill grants (if it's an active skill); streamed in as the skill nears unlock
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
-	TSubclassOf<class UGameplayAbility> GrantedAbility;
+	TSoftClassPtr<class UGameplayAbility> GrantedAbility;
 
 	// Gameplay tags that describe this skill
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
@@ -69,9 +75,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
 	FGameplayTagContainer BlockedTags;
 
-	// Gameplay effects granted by this skill (for passive abilities)
+	// Gameplay effects granted by this skill (for passive abilities); streamed in as the skill nears unlock
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
-	TArray<TSubclassOf<class UGameplayEffect>> GrantedEffects;
+	TArray<TSoftClassPtr<class UGameplayEffect>> GrantedEffects;
 
 	// The power level of this skill (calculated from component concepts)
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill", meta = (ClampMin = "1"))
@@ -81,6 +87,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill", meta = (ClampMin = "0.0"))
 	float Cooldown;
 
+	// Input the granted ability is bound to (INDEX_NONE for none); input-bound abilities are granted first
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept Skill")
+	int32 InputID;
+
 	// Get the unique identifier for this skill
 	FPRIMARY_ASSET_ID GetPrimaryAssetId() const override;
 
@@ -96,7 +106,49 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Concept Skill")
 	bool HasSkillTag(const FGameplayTag& Tag) const;
 
+	// Whether this skill grants an ability
+	bool HasGrantedAbility() const { return !GrantedAbility.IsNull(); }
+
+	// The granted ability class, loading it synchronously if it was not prefetched
+	TSubclassOf<class UGameplayAbility> ResolveGrantedAbility() const;
+
+	// The granted effect classes, loading any that were not prefetched synchronously
+	TArray<TSubclassOf<class UGameplayEffect>> ResolveGrantedEffects() const;
+
+	// Paths of the ability and effect classes, for async loading
+	void GetGrantedClassPaths(TArray<FSoftObjectPath>& OutPaths) const;
+
+	// Whether every granted class is already loaded
+	bool AreGrantedClassesLoaded() const;
+
 	// Get the gameplay ability specification for this skill
 	UFUNCTION(BlueprintCallable, Category = "Concept Skill")
 	FGameplayAbilitySpec GetAbilitySpec(int32 Level = 1) const;
+
+	// Compile RequirementExpression; done on load and edit, and needed after changing requirements at runtime
+	void CompileRequirements();
+
+	// The compiled requirements, compiling them first if they never were (game thread)
+	const FConceptRequirementProgram& GetRequirementProgram();
+
+	// Whether the compiled requirements are met; safe on any thread once compiled
+	bool AreRequirementsMet(const FConceptRequirementContext& Context) const { return RequirementProgram.Evaluate(Context); }
+
+	// The compiled requirements without compiling them; safe on any thread once GetRequirementProgram has run
+	const FConceptRequirementProgram& GetCompiledRequirementProgram() const { return RequirementProgram; }
+
+	// Begin UObject
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	// End UObject
+
+	// Bytes of this skill that server cooks leave out
+	SIZE_T GetDisplayDataSize() const;
+
+private:
+	// RequirementExpression compiled, or every required concept at RequiredMasteryLevel
+	FConceptRequirementProgram RequirementProgram;
 };
@@ -22,7 +22,6 @@ public:
 	AConceptSkillDebugger();
 
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
 
 	// The target actor to debug
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept Skill Debugger")
@@ -9,10 +9,101 @@
 #include "GameplayEffect.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayCueInterface.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/StreamableManager.h"
+#include "ConceptSkillProximity.h"
 #include "ConceptSkillManager.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSkillUnlocked, UConceptSkill*, Skill);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSkillRemoved, UConceptSkill*, Skill);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAbilitiesReady);
+
+// Order in which queued grants are processed
+enum class EConceptGrantPriority : uint8
+{
+	InputBound,
+	Active,
+	Passive,
+	Count
+};
+
+/**
+ * FConceptCueBatchEntry - Gameplay cue executions merged for one (target, tag) pair within a frame
+ * When dispatched, RawMagnitude carries the combined magnitude and UConceptSkillManager::GetDispatchedCueCount the
+ * execution count; every other parameter, the effect level included, is the first execution's
+ */
+USTRUCT()
+struct CONCEPTSKILLSYSTEM_API FConceptCueBatchEntry
+{
+	GENERATED_BODY()
+
+	// The actor the cue is executed on
+	UPROPERTY()
+	AActor* Target = nullptr;
+
+	// The gameplay cue tag
+	UPROPERTY()
+	FGameplayTag CueTag;
+
+	// Parameters of the first execution merged into this entry
+	UPROPERTY()
+	FGameplayCueParameters Parameters;
+
+	// Number of executions merged into this entry
+	UPROPERTY()
+	uint16 Count = 0;
+
+	// Sum of the magnitudes of all merged executions
+	UPROPERTY()
+	float CombinedMagnitude = 0.0f;
+};
+
+// A skill and how far the character is from unlocking it
+USTRUCT(BlueprintType)
+struct CONCEPTSKILLSYSTEM_API FConceptSkillProximity
+{
+	GENERATED_BODY()
+
+	// The skill
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Skill System")
+	TSoftObjectPtr<UConceptSkill> Skill;
+
+	// Required concepts not acquired yet
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Skill System")
+	int32 MissingConcepts = 0;
+
+	// Mastery levels still to gain on the required concepts already acquired
+	UPROPERTY(BlueprintReadOnly, Category = "Concept Skill System")
+	int32 MasteryDeficit = 0;
+};
+
+/**
+ * FConceptUnlockSnapshot - Read-only copy of what a skill manager needs to decide which skills it can unlock
+ * Built on the game thread, evaluated on any thread, committed back on the game thread
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptUnlockSnapshot
+{
+	// Highest mastery of each acquired concept (0 if acquired but not slotted)
+	TMap<FSoftObjectPath, int32> MasteryByConcept;
+
+	// Tags the owner's ability system has, for tag predicates in requirement expressions
+	FGameplayTagContainer OwnerTags;
+
+	// Available skills not yet unlocked
+	TArray<UConceptSkill*> Candidates;
+
+	// Candidates whose requirements are met, filled by Evaluate
+	TArray<UConceptSkill*> Eligible;
+
+	// Candidates missing at most this many requirements are reported as near unlock
+	int32 PrefetchDistance = 0;
+
+	// Candidates within PrefetchDistance of unlocking, filled by Evaluate
+	TArray<UConceptSkill*> NearUnlock;
+
+	// Find the eligible candidates; touches only the snapshot and immutable skill data, so it is safe off the game thread
+	void Evaluate();
+};
 
 /**
  * UConceptSkillManager - Component that manages skill creation and usage
@@ -27,7 +118,7 @@ public:
 	UConceptSkillManager();
 
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Reference to the concept component on the same actor
 	UPROPERTY(BlueprintReadOnly, Category = "Concept Skill System")
@@ -72,10 +163,41 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Concept Skill System")
 	FOnSkillRemoved OnSkillRemoved;
 
+	// Broadcast when every queued ability grant and passive effect has been applied
+	UPROPERTY(BlueprintAssignable, Category = "Concept Skill System")
+	FOnAbilitiesReady OnAbilitiesReady;
+
+	// Skills missing at most this many requirements have their ability and effect classes streamed in ahead of unlock
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept Skill System", meta = (ClampMin = "0"))
+	int32 PrefetchRequirementDistance;
+
+	// Whether cue executions for the same target and tag are merged until the end of the frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept Skill System")
+	bool bAggregateGameplayCues;
+
+	// Most merged cue executions sent in one unreliable multicast; larger batches are split across several
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept Skill System", meta = (ClampMin = "1"))
+	int32 MaxCuesPerBatch;
+
 	// Check for new skills that can be unlocked based on acquired concepts
 	UFUNCTION(BlueprintCallable, Category = "Concept Skill System")
 	void CheckForNewSkills();
 
+	// Queue this manager for the concept system's batched unlock evaluation at the end of the frame
+	void MarkUnlockStateDirty();
+
+	// Copy the concept state and candidate skills needed for unlock evaluation (game thread)
+	void BuildUnlockSnapshot(FConceptUnlockSnapshot& OutSnapshot) const;
+
+	// Unlock the skills an evaluated snapshot found eligible (game thread); skills whose classes are still streaming in
+	// unlock when the load completes
+	void CommitUnlockSnapshot(const FConceptUnlockSnapshot& Snapshot);
+
+	// The available skills not yet unlocked that the character is closest to unlocking, nearest first:
+	// fewest missing concepts, then least mastery still to gain
+	UFUNCTION(BlueprintCallable, Category = "Concept Skill System")
+	TArray<FConceptSkillProximity> GetNearestUnlockableSkills(int32 Count = 5);
+
 	// Unlock a specific skill if requirements are met
 	UFUNCTION(BlueprintCallable, Category = "Concept Skill System")
 	bool UnlockSkill(UConceptSkill* Skill);
@@ -104,6 +226,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Concept Skill System")
 	void GrantAbilitiesForUnlockedSkills();
 
+	// Queue grants for unlocked skills that are not granted yet, processed by the concept system within its grant budget:
+	// input-bound abilities first, then other actives, then passives. Like UnlockSkill, only active skills grant abilities
+	// and only passives apply effects; safe to call again, e.g. once the ability system is initialized.
+	UFUNCTION(BlueprintCallable, Category = "Concept Skill System")
+	void QueueAbilityGrants();
+
+	// Whether no queued grants remain
+	UFUNCTION(BlueprintCallable, Category = "Concept Skill System")
+	bool AreAbilitiesReady() const;
+
+	// Whether grants remain at a priority
+	bool HasPendingGrants(EConceptGrantPriority Priority) const;
+
+	// Whether the classes for queued grants have finished streaming in
+	bool IsReadyToGrant() const;
+
+	// Grant or apply the next queued skill at a priority
+	void ProcessNextGrant(EConceptGrantPriority Priority);
+
+	// Apply the gameplay effects of one passive skill
+	void ApplyPassiveEffectsForSkill(UConceptSkill* Skill);
+
 	// Grant a gameplay ability for a specific skill
 	UFUNCTION(BlueprintCallable, Category = "Concept Skill System")
 	FGameplayAbilitySpecHandle GrantAbilityForSkill(UConceptSkill* Skill);
@@ -126,16 +270,100 @@ public:
 
 	// Execute a gameplay cue for a specific skill
 	UFUNCTION(BlueprintCallable, Category = "Concept Skill Manager")
-	void ExecuteGameplayCueForSkill(UConceptSkill* Skill, AActor* Target);
+	void ExecuteGameplayCueForSkill(UConceptSkill* Skill, AActor* Target, float Magnitude = 1.0f);
+
+	// Queue a gameplay cue execution; executions for the same target and tag are merged until the concept system flushes them at the end of the frame
+	UFUNCTION(BlueprintCallable, Category = "Concept Skill Manager")
+	void QueueGameplayCue(AActor* Target, FGameplayTag CueTag, const FGameplayCueParameters& Parameters, float Magnitude = 1.0f);
+
+	// Dispatch every cue execution queued this frame as one batch
+	void FlushPendingCues();
+
+	// Send a batch of merged cue executions to all clients in a single net message
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastExecuteCueBatch(const TArray<FConceptCueBatchEntry>& Batch);
 
 	// Get all skills with a specific gameplay tag
 	UFUNCTION(BlueprintCallable, Category = "Concept Skill System")
 	TArray<UConceptSkill*> GetSkillsWithTag(const FGameplayTag& Tag) const;
 
+	// Number of merged executions behind the gameplay cue being dispatched, for cue handlers; 1 outside a batch
+	static int32 GetDispatchedCueCount();
+
 private:
 	// Categorize skills by their manifestation type
 	void CategorizeSkill(UConceptSkill* Skill);
 
 	// Remove a skill from its category
 	void RemoveSkillFromCategory(UConceptSkill* Skill);
+
+	// Forward a batch of merged cue executions to the gameplay cue manager
+	void DispatchCueBatch(const TArray<FConceptCueBatchEntry>& Batch) const;
+
+	// Concept state changes that can make new skills unlockable
+	UFUNCTION()
+	void HandleConceptAcquired(UConcept* Concept, FConceptSlot Slot);
+
+	UFUNCTION()
+	void HandleConceptMasteryChanged(UConcept* Concept, int32 NewMasteryLevel);
+
+	// Listen for the gameplay tags the requirement expressions of AvailableSkills test, so gaining or losing one
+	// re-evaluates unlocks
+	void RegisterRequirementTagEvents();
+	void UnregisterRequirementTagEvents();
+
+	// A tag a requirement expression tests was added to or removed from the owner
+	void HandleRequirementTagChanged(const FGameplayTag Tag, int32 NewCount);
+
+	// Tag events registered on AbilitySystemComponent by RegisterRequirementTagEvents
+	TMap<FGameplayTag, FDelegateHandle> RequirementTagHandles;
+
+	// Whether this manager is already queued for unlock evaluation
+	bool bUnlockEvaluationQueued;
+
+	// Queue a skill at the priority its manifestation and input binding give it, unless it has nothing to grant or is granted
+	void EnqueueGrant(UConceptSkill* Skill);
+
+	// Whether a skill's ability is given, or its passive effects are applied, on the ability system
+	bool IsSkillGranted(const UConceptSkill* Skill) const;
+
+	// Remove every passive effect applied by concept skills
+	void RemovePassiveEffects();
+
+	// Broadcast OnAbilitiesReady once nothing is left to grant
+	void FinishGrantsIfDrained();
+
+	// Start streaming in the ability and effect classes of skills about to be unlocked
+	void PrefetchSkillClasses(TConstArrayView<UConceptSkill*> Skills);
+
+	// Unlock an eligible skill once its classes have streamed in, so granting it never loads synchronously
+	void UnlockWhenLoaded(UConceptSkill* Skill);
+
+	// A deferred unlock's classes finished streaming in (or the load was canceled)
+	void HandleDeferredUnlockLoaded(TWeakObjectPtr<UConceptSkill> Skill);
+
+	// AvailableSkills indexed for GetNearestUnlockableSkills, rebuilt when the catalog or the skill list changes
+	FConceptSkillProximityIndex SkillProximity;
+
+	// Keeps prefetched classes resident until their skill is unlocked and granted
+	TMap<TObjectKey<UConceptSkill>, TSharedPtr<FStreamableHandle>> PrefetchHandles;
+
+	// Eligible skills waiting on their prefetch before they are unlocked
+	TSet<TObjectKey<UConceptSkill>> DeferredUnlocks;
+
+	// Load of every class the grant queue needs
+	TSharedPtr<FStreamableHandle> GrantLoadHandle;
+
+	// Skills waiting to be granted, one queue per EConceptGrantPriority
+	TArray<TWeakObjectPtr<UConceptSkill>> GrantQueues[static_cast<int32>(EConceptGrantPriority::Count)];
+
+	// Whether grants are queued and OnAbilitiesReady has not fired yet
+	bool bGrantsPending;
+
+	// Cue executions queued this frame
+	UPROPERTY(Transient)
+	TArray<FConceptCueBatchEntry> PendingCues;
+
+	// Index into PendingCues for each (target, tag) pair queued this frame
+	TMap<TPair<TObjectKey<AActor>, FGameplayTag>, int32> PendingCueIndices;
 };
@@ -0,0 +1,90 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FConceptCatalog;
+class UConceptSkill;
+
+// How far a skill is from being unlocked, as found by FConceptSkillProximityIndex::FindNearest
+struct FConceptSkillProximityResult
+{
+	// Position of the skill in the index
+	int32 Position;
+
+	// Required concepts not acquired
+	int32 Missing;
+
+	// Mastery levels still to gain on the acquired required concepts, against each concept's threshold
+	int32 Deficit;
+
+	bool operator<(const FConceptSkillProximityResult& Other) const
+	{
+		return Missing != Other.Missing ? Missing < Other.Missing : Deficit != Other.Deficit ? Deficit < Other.Deficit : Position < Other.Position;
+	}
+};
+
+/**
+ * FConceptSkillProximityIndex - Ranks a set of skills by how close a character is to unlocking them
+ * Requirement masks from the concept catalog are stored sparsely, only their non-zero words, since a skill needs a
+ * handful of concepts out of thousands; the missing count is a popcount of each word against the acquired bitset.
+ * A bounded heap keeps the best K, and the mastery deficit is only computed for skills that can still enter it.
+ * A skill's mask holds the concepts its compiled requirement expression refers to outside a NOT, so OR and N-of-M
+ * groups count every concept as missing and tag terms are not ranked; the distance is an upper bound for those.
+ * Implements the "Dynamic Progression Through Mastery" design pillar
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptSkillProximityIndex
+{
+	// Index the given skills against a catalog; skills not in the catalog are left out
+	void Build(const FConceptCatalog& Catalog, TConstArrayView<TSoftObjectPtr<UConceptSkill>> InSkills);
+
+	// Whether the index was built against this catalog from these skills, in this order
+	bool IsBuiltFor(const FConceptCatalog& Catalog, TConstArrayView<TSoftObjectPtr<UConceptSkill>> InSkills) const;
+
+	// Force the next IsBuiltFor to fail
+	void Invalidate() { CatalogVersion = 0; }
+
+	// Hash of a skill list's paths, so edits that keep the count still rebuild the index
+	static uint32 HashSkills(TConstArrayView<TSoftObjectPtr<UConceptSkill>> InSkills);
+
+	// Position of a catalog skill in the index (INDEX_NONE if not indexed)
+	int32 GetPosition(int32 SkillIndex) const { return PositionBySkillIndex.IsValidIndex(SkillIndex) ? PositionBySkillIndex[SkillIndex] : INDEX_NONE; }
+
+	// Skill at a position
+	const TSoftObjectPtr<UConceptSkill>& GetSkill(int32 Position) const { return Skills[Position]; }
+
+	// Number of indexed skills
+	int32 Num() const { return Skills.Num(); }
+
+	/**
+	 * The K skills nearest to unlock, nearest first: fewest missing concepts, then least mastery deficit
+	 * Acquired: bitset over catalog concepts (MaskWords words). Mastery: highest mastery by catalog concept index, for
+	 * the slotted concepts only (others count as 0). Excluded: positions to skip (e.g. skills already unlocked), or empty.
+	 */
+	void FindNearest(TConstArrayView<uint64> Acquired, const TMap<int32, uint8>& Mastery, const TBitArray<>& Excluded, int32 K,
+		TArray<FConceptSkillProximityResult>& OutNearest) const;
+
+private:
+	// The indexed skills
+	TArray<TSoftObjectPtr<UConceptSkill>> Skills;
+
+	// Mastery thresholds of the requirement expression, as compressed sparse rows: skill P tests concept
+	// ThresholdConcepts[I] against ThresholdLevels[I] for I in [ThresholdStarts[P], ThresholdStarts[P + 1])
+	TArray<uint32> ThresholdStarts;
+	TArray<int32> ThresholdConcepts;
+	TArray<uint8> ThresholdLevels;
+
+	// Non-zero requirement words as compressed sparse rows: skill P has words [WordStarts[P], WordStarts[P + 1])
+	TArray<uint32> WordStarts;
+	TArray<uint32> WordIndices;
+	TArray<uint64> WordBits;
+
+	// Position of each catalog skill (INDEX_NONE if not indexed)
+	TArray<int32> PositionBySkillIndex;
+
+	// Version of the catalog the index was built against, and the skill list it was built from
+	uint32 CatalogVersion = 0;
+	int32 NumSourceSkills = 0;
+	uint32 SourceHash = 0;
+};
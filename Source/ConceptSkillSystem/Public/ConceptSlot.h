@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Concept.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "ConceptSlot.generated.h"
 
 UENUM(BlueprintType)
@@ -21,7 +22,7 @@ enum class EBodyPartType : uint8
  * Used by both characters (body parts) and objects
  */
 USTRUCT(BlueprintType)
-struct CONCEPTSKILLSYSTEM_API FConceptSlot
+struct CONCEPTSKILLSYSTEM_API FConceptSlot : public FFastArraySerializerItem
 {
 	GENERATED_BODY()
 
@@ -40,9 +41,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept Slot")
 	bool bIsUnlocked;
 
-	// The mastery level of the concept in this slot (0-100)
+	// The mastery level of the concept in this slot (0-100), quantized to a byte for replication
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept Slot", meta = (ClampMin = "0", ClampMax = "100"))
-	int32 MasteryLevel;
+	uint8 MasteryLevel;
 
 	// The maximum tier of concept this slot can hold
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Concept Slot")
@@ -73,4 +74,56 @@ public:
 
 	// Increase the mastery level of the concept in this slot
 	void IncreaseMastery(int32 Amount);
+
+	// FFastArraySerializer callbacks
+	void PostReplicatedAdd(const struct FConceptSlotContainer& InArraySerializer);
+	void PostReplicatedChange(const struct FConceptSlotContainer& InArraySerializer);
+};
+
+/**
+ * FConceptSlotContainer - Delta-replicated store for a character's concept slots
+ * Only slots marked dirty are sent, so a single mastery change costs a few bytes instead of the whole set
+ */
+USTRUCT()
+struct CONCEPTSKILLSYSTEM_API FConceptSlotContainer : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+public:
+	// All slots, across every body part
+	UPROPERTY(VisibleAnywhere, Category = "Concept Slot")
+	TArray<FConceptSlot> Items;
+
+	// The component that owns this container (not replicated)
+	class UConceptComponent* Owner = nullptr;
+
+	// Add a slot and mark it for replication; on the wire it is identified by its fast array ReplicationID
+	FConceptSlot& AddSlot(const FConceptSlot& Slot);
+
+	// Remove every slot
+	void Reset();
+
+	// Find a slot by its unique ID
+	FConceptSlot* FindById(const FGuid& SlotId);
+	const FConceptSlot* FindById(const FGuid& SlotId) const;
+
+	// Get copies of all slots for a specific body part
+	TArray<FConceptSlot> GetSlotsForBodyPart(EBodyPartType BodyPart) const;
+
+	// Get the highest mastery level held for a concept across all slots (0 if not held)
+	int32 GetHighestMastery(const UConcept* Concept) const;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FConceptSlot, FConceptSlotContainer>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FConceptSlotContainer> : public TStructOpsTypeTraitsBase2<FConceptSlotContainer>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
 };
@@ -0,0 +1,80 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "ConceptSlot.h"
+
+class UConceptComponent;
+
+/**
+ * FConceptSlotUndo - The fields of a slot as they were before a snapshot first touched it
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptSlotUndo
+{
+	TSoftObjectPtr<UConcept> HeldConcept;
+	EBodyPartType BodyPart = EBodyPartType::None;
+	EConceptTier MaxTier = EConceptTier::Physical;
+	uint8 MasteryLevel = 0;
+	bool bIsUnlocked = false;
+
+	void Capture(const FConceptSlot& Slot);
+	void Restore(FConceptSlot& Slot) const;
+};
+
+/**
+ * FConceptStateSnapshot - Copy-on-write undo log for concept state
+ * Nothing is copied when the snapshot opens; each field is saved the first time it changes,
+ * so restoring costs O(changed) rather than O(state)
+ */
+struct CONCEPTSKILLSYSTEM_API FConceptStateSnapshot
+{
+	// Prediction key for predicted activations, negative for previews
+	int32 Key = 0;
+
+	// Original slot fields, keyed by slot index
+	TMap<int32, FConceptSlotUndo> Slots;
+
+	// Original progression pool, once it has changed
+	TOptional<float> ProgressionPool;
+
+	// Concepts added to the observed/acquired sets while open (those sets only grow)
+	TArray<TSoftObjectPtr<UConcept>> AddedObserved;
+	TArray<TSoftObjectPtr<UConcept>> AddedAcquired;
+
+	// Number of mediated skills when the snapshot opened (skills are only appended)
+	int32 MediatedSkillCount = 0;
+
+	// Loose gameplay tags added while open, one entry per add so tag counts unwind exactly
+	TArray<FGameplayTag> AddedTags;
+
+	// Sizes of the component's preview scratch tags and mediated skills when the snapshot opened (both only grow)
+	int32 PreviewTagCount = 0;
+	int32 PreviewMediatedSkillCount = 0;
+};
+
+/**
+ * FConceptPreviewScope - Lets callers mutate concept state for a "what-if" query and undoes it on scope exit
+ * Journaling, delegates, ability level updates and replication dirtying are suppressed for the lifetime of the scope,
+ * and tags and mediated skills go to scratch copies instead of the ability system and the replicated array
+ *
+ *	{
+ *		FConceptPreviewScope Preview(ConceptComponent);
+ *		ConceptComponent->IncreaseMastery(SlotId, 10);
+ *		bCouldUnlock = SkillManager->CanUnlockSkill(Skill);
+ *	}
+ */
+class CONCEPTSKILLSYSTEM_API FConceptPreviewScope
+{
+public:
+	explicit FConceptPreviewScope(UConceptComponent* InComponent);
+	~FConceptPreviewScope();
+
+	FConceptPreviewScope(const FConceptPreviewScope&) = delete;
+	FConceptPreviewScope& operator=(const FConceptPreviewScope&) = delete;
+
+private:
+	TWeakObjectPtr<UConceptComponent> Component;
+	int32 Key;
+};
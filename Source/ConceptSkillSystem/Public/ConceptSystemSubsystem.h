@@ -0,0 +1,106 @@
+// Copyright Koorogi Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ConceptSystemSubsystem.generated.h"
+
+class UConceptComponent;
+class UConceptSkillManager;
+
+/**
+ * UConceptSystemSubsystem - The one per-frame update for the whole concept system
+ * Concept actors and components do not tick; work they need each frame is queued here and run in batches,
+ * with a time budget that scales with the frame time
+ * Implements the "Dynamic Progression Through Mastery" design pillar
+ */
+UCLASS(Config = Game)
+class CONCEPTSKILLSYSTEM_API UConceptSystemSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UConceptSystemSubsystem();
+
+	// Begin USubsystem
+	virtual void Deinitialize() override;
+	// End USubsystem
+
+	// Begin FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// End FTickableGameObject
+
+	// Fraction of the (smoothed) frame time the budgeted work may use
+	UPROPERTY(Config, EditAnywhere, Category = "Concept System", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float FrameBudgetFraction;
+
+	// Lower bound of the per-frame budget, in milliseconds
+	UPROPERTY(Config, EditAnywhere, Category = "Concept System", meta = (ClampMin = "0.0"))
+	float MinBudgetMs;
+
+	// Upper bound of the per-frame budget, in milliseconds
+	UPROPERTY(Config, EditAnywhere, Category = "Concept System", meta = (ClampMin = "0.0"))
+	float MaxBudgetMs;
+
+	// Milliseconds per frame spent granting queued abilities and passive effects, across all characters (at least one grant per frame)
+	UPROPERTY(Config, EditAnywhere, Category = "Concept System", meta = (ClampMin = "0.0"))
+	float GrantBudgetMs;
+
+	// Drain a skill manager's grant queue over the next frames
+	void QueueAbilityGrants(UConceptSkillManager* SkillManager);
+
+	// Flush a skill manager's merged gameplay cues at the end of this frame
+	void QueueCueFlush(UConceptSkillManager* SkillManager);
+
+	// Evaluate a skill manager's unlocks in this frame's parallel batch
+	void QueueUnlockEvaluation(UConceptSkillManager* SkillManager);
+
+	// Evaluate every queued skill manager now: snapshots are evaluated in parallel, unlocks committed serially
+	void EvaluatePendingUnlocks();
+
+	// Rebuild a component's public summary once its SummaryUpdateInterval has passed
+	void QueueSummaryUpdate(UConceptComponent* Component);
+
+	// Time budget for the current frame, in seconds
+	double GetFrameBudget() const;
+
+	// Get the subsystem for a world
+	static UConceptSystemSubsystem* Get(const UObject* WorldContextObject);
+
+private:
+	struct FPendingSummary
+	{
+		TWeakObjectPtr<UConceptComponent> Component;
+		double DueTime;
+
+		// Heap order: earliest due first
+		bool operator<(const FPendingSummary& Other) const { return DueTime < Other.DueTime; }
+	};
+
+	// Process queued grants by priority across all skill managers until the grant budget runs out
+	void ProcessGrants();
+
+	// Send every queued cue batch (not budgeted: cues belong to this frame)
+	void FlushCues();
+
+	// Rebuild due public summaries until the deadline, always at least one
+	void UpdateSummaries(double Now, double Deadline);
+
+	// Frame time averaged over recent frames, so one hitch doesn't swing the budget
+	float SmoothedDeltaTime;
+
+	// Skill managers with queued grants
+	TArray<TWeakObjectPtr<UConceptSkillManager>> PendingGrants;
+
+	// Skill managers whose concept state changed this frame
+	TArray<TWeakObjectPtr<UConceptSkillManager>> PendingUnlockEvaluations;
+
+	// Skill managers with cues queued this frame
+	TArray<TWeakObjectPtr<UConceptSkillManager>> PendingCueFlushes;
+
+	// Components with a dirty public summary, as a min-heap on due time; intervals differ per component,
+	// so the order they became dirty in says nothing about the order they come due
+	TArray<FPendingSummary> PendingSummaries;
+};
@@ -36,7 +36,6 @@ public:
 	AConceptualObject();
 
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
 
 	// The intrinsic concepts that are inherent to this object type
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Concept System")
@@ -104,6 +103,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	bool ApplyDegradation(int32 Amount);
 
+	// Write quality, durability and slots to a compact binary blob
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Save")
+	bool SaveObjectState(TArray<uint8>& OutData) const;
+
+	// Restore state written by SaveObjectState; fails on version or catalog mismatch
+	UFUNCTION(BlueprintCallable, Category = "Concept System|Save")
+	bool LoadObjectState(const TArray<uint8>& Data);
+
 	// New function for over-slotting mechanic with risk of degradation or breakage
 	UFUNCTION(BlueprintCallable, Category = "Concept System")
 	bool OverSlotConcept(UConcept* Concept);  // Attempt to add a concept to a full object with associated risks
@@ -112,6 +119,16 @@ private:
 	// Initialize slots based on quality
 	void InitializeSlots();
 
+	// Build the slot InitializeSlots creates at an index for the current quality
+	FConceptSlot MakeDefaultSlot(int32 Index) const;
+
+	// Optional sections of the saved object state
+	enum ESaveSection : uint8
+	{
+		SaveSection_Quality = 1 << 0,
+		SaveSection_Durability = 1 << 1
+	};
+
 	// Find the first empty slot that can hold the given concept
 	bool FindEmptySlotForConcept(UConcept* Concept, FConceptSlot& OutSlot);
 